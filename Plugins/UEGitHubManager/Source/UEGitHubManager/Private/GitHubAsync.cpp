@@ -0,0 +1,63 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubAsync.h"
+#include "Misc/ScopeLock.h"
+
+TSharedRef<FGitHubCancellationToken, ESPMode::ThreadSafe> FGitHubCancellationToken::Create()
+{
+    return MakeShared<FGitHubCancellationToken, ESPMode::ThreadSafe>();
+}
+
+void FGitHubCancellationToken::Cancel()
+{
+    TArray<TPair<FDelegateHandle, TFunction<void()>>> Handlers;
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (bCancelled)
+        {
+            return;
+        }
+        bCancelled = true;
+        Handlers = MoveTemp(CancelHandlers);
+    }
+
+    // Outside the lock, the handlers complete promises whose continuations may touch the token again
+    for (TPair<FDelegateHandle, TFunction<void()>>& Handler : Handlers)
+    {
+        Handler.Value();
+    }
+}
+
+bool FGitHubCancellationToken::IsCancelled() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return bCancelled;
+}
+
+FDelegateHandle FGitHubCancellationToken::AddCancelHandler(TFunction<void()> Handler)
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (!bCancelled)
+        {
+            const FDelegateHandle Handle(FDelegateHandle::GenerateNewHandle);
+            CancelHandlers.Emplace(Handle, MoveTemp(Handler));
+            return Handle;
+        }
+    }
+
+    Handler();
+    return FDelegateHandle();
+}
+
+void FGitHubCancellationToken::RemoveCancelHandler(FDelegateHandle Handle)
+{
+    if (!Handle.IsValid())
+    {
+        return;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    CancelHandlers.RemoveAll([&Handle](const TPair<FDelegateHandle, TFunction<void()>>& Candidate) { return Candidate.Key == Handle; });
+}
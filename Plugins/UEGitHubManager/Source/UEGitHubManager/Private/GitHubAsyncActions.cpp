@@ -0,0 +1,177 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubAsyncActions.h"
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+void UGitHubAsyncAction::Cancel()
+{
+    Token->Cancel();
+    Super::Cancel();
+}
+
+void UGitHubAsyncAction::SetReadyToDestroy()
+{
+    if (IsRooted())
+    {
+        RemoveFromRoot();
+    }
+    Super::SetReadyToDestroy();
+}
+
+void UGitHubAsyncAction::RegisterWithContext(const UObject* WorldContextObject)
+{
+    const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    if (World && World->GetGameInstance())
+    {
+        RegisterWithGameInstance(World->GetGameInstance());
+        return;
+    }
+
+    // Editor Utility Widgets have no game instance, nothing else would keep the node from being collected mid request
+    AddToRoot();
+}
+
+void UGitHubAsyncTextAction::Complete(TGitHubFuture<FString>&& Future)
+{
+    TWeakObjectPtr<UGitHubAsyncTextAction> WeakThis(this);
+    Future.Next([WeakThis](TGitHubResult<FString> Result)
+        {
+            const bool bSucceeded = Result.HasValue();
+            FString Text = bSucceeded ? Result.StealValue() : Result.StealError();
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, bSucceeded, Text = MoveTemp(Text)]()
+                {
+                    UGitHubAsyncTextAction* Action = WeakThis.Get();
+                    if (!Action || !Action->ShouldBroadcastDelegates())
+                    {
+                        return;
+                    }
+
+                    if (bSucceeded)
+                    {
+                        Action->OnSuccess.Broadcast(Text, FString());
+                    }
+                    else
+                    {
+                        Action->OnFailure.Broadcast(FString(), Text);
+                    }
+                    Action->SetReadyToDestroy();
+                });
+        });
+}
+
+UGitHubFetchCurrentUserAction* UGitHubFetchCurrentUserAction::FetchCurrentUserAsync(UObject* WorldContextObject)
+{
+    UGitHubFetchCurrentUserAction* Action = NewObject<UGitHubFetchCurrentUserAction>();
+    Action->RegisterWithContext(WorldContextObject);
+    return Action;
+}
+
+void UGitHubFetchCurrentUserAction::Activate()
+{
+    Complete(UGitHubAPIManager::GetInstance()->FetchCurrentUserAsync(Token));
+}
+
+UGitHubCreateProjectAction* UGitHubCreateProjectAction::CreateNewProjectAsync(UObject* WorldContextObject, const FString& Owner, const FString& ProjectName)
+{
+    UGitHubCreateProjectAction* Action = NewObject<UGitHubCreateProjectAction>();
+    Action->RegisterWithContext(WorldContextObject);
+    Action->Owner = Owner;
+    Action->ProjectName = ProjectName;
+    return Action;
+}
+
+void UGitHubCreateProjectAction::Activate()
+{
+    Complete(UGitHubAPIManager::GetInstance()->CreateNewProjectAsync(Owner, ProjectName, Token));
+}
+
+UGitHubCreateProjectItemAction* UGitHubCreateProjectItemAction::CreateProjectItemAsync(UObject* WorldContextObject, const FString& ProjectId, const FString& Title, const FString& FieldId, const FString& ColumnId)
+{
+    UGitHubCreateProjectItemAction* Action = NewObject<UGitHubCreateProjectItemAction>();
+    Action->RegisterWithContext(WorldContextObject);
+    Action->ProjectId = ProjectId;
+    Action->Title = Title;
+    Action->FieldId = FieldId;
+    Action->ColumnId = ColumnId;
+    return Action;
+}
+
+void UGitHubCreateProjectItemAction::Activate()
+{
+    Complete(UGitHubAPIManager::GetInstance()->CreateProjectItemAsync(ProjectId, Title, FieldId, ColumnId, Token));
+}
+
+UGitHubMoveProjectItemAction* UGitHubMoveProjectItemAction::MoveProjectItemAsync(UObject* WorldContextObject, const FString& ProjectId, const FString& ItemId, const FString& NewColumnId, const FString& StatusFieldId)
+{
+    UGitHubMoveProjectItemAction* Action = NewObject<UGitHubMoveProjectItemAction>();
+    Action->RegisterWithContext(WorldContextObject);
+    Action->ProjectId = ProjectId;
+    Action->ItemId = ItemId;
+    Action->NewColumnId = NewColumnId;
+    Action->StatusFieldId = StatusFieldId;
+    return Action;
+}
+
+void UGitHubMoveProjectItemAction::Activate()
+{
+    Complete(UGitHubAPIManager::GetInstance()->MoveProjectItemAsync(ProjectId, ItemId, NewColumnId, StatusFieldId, Token));
+}
+
+UGitHubUpdateItemDateAction* UGitHubUpdateItemDateAction::UpdateProjectItemDateValueAsync(UObject* WorldContextObject, const FString& ProjectId, const FString& ItemId, const FString& FieldId, const FString& NewDateValue)
+{
+    UGitHubUpdateItemDateAction* Action = NewObject<UGitHubUpdateItemDateAction>();
+    Action->RegisterWithContext(WorldContextObject);
+    Action->ProjectId = ProjectId;
+    Action->ItemId = ItemId;
+    Action->FieldId = FieldId;
+    Action->NewDateValue = NewDateValue;
+    return Action;
+}
+
+void UGitHubUpdateItemDateAction::Activate()
+{
+    Complete(UGitHubAPIManager::GetInstance()->UpdateProjectItemDateValueAsync(ProjectId, ItemId, FieldId, NewDateValue, Token));
+}
+
+UGitHubFetchProjectBoardAction* UGitHubFetchProjectBoardAction::FetchProjectDetailsAsync(UObject* WorldContextObject, const FString& ProjectId)
+{
+    UGitHubFetchProjectBoardAction* Action = NewObject<UGitHubFetchProjectBoardAction>();
+    Action->RegisterWithContext(WorldContextObject);
+    Action->ProjectId = ProjectId;
+    return Action;
+}
+
+void UGitHubFetchProjectBoardAction::Activate()
+{
+    TWeakObjectPtr<UGitHubFetchProjectBoardAction> WeakThis(this);
+    UGitHubAPIManager::GetInstance()->FetchProjectDetailsAsync(ProjectId, Token).Next([WeakThis](TGitHubResult<FGitHubBoardHandle> Result)
+        {
+            const bool bSucceeded = Result.HasValue();
+            FGitHubBoardHandle Board = bSucceeded ? Result.StealValue() : FGitHubBoardHandle();
+            FString Error = bSucceeded ? FString() : Result.StealError();
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, bSucceeded, Board = MoveTemp(Board), Error = MoveTemp(Error)]()
+                {
+                    UGitHubFetchProjectBoardAction* Action = WeakThis.Get();
+                    if (!Action || !Action->ShouldBroadcastDelegates())
+                    {
+                        return;
+                    }
+
+                    if (bSucceeded)
+                    {
+                        Action->OnSuccess.Broadcast(Board, FString());
+                    }
+                    else
+                    {
+                        Action->OnFailure.Broadcast(FGitHubBoardHandle(), Error);
+                    }
+                    Action->SetReadyToDestroy();
+                });
+        });
+}
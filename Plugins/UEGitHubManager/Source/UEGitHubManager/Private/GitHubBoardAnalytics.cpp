@@ -0,0 +1,267 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubBoardAnalytics.h"
+
+namespace
+{
+    // Upper bounds of the histogram buckets in hours, one hour up to a month, the last bucket is open
+    const float HistogramBoundsHours[] = { 1.0f, 4.0f, 24.0f, 72.0f, 168.0f, 336.0f, 720.0f };
+    constexpr int32 NumHistogramBuckets = UE_ARRAY_COUNT(HistogramBoundsHours) + 1;
+}
+
+void FGitHubBoardAnalytics::SyncBoard(const FProjectInfo& Board, const FDateTime& Now)
+{
+    // Completions mean something else once another column is the done one, the counts start over
+    const FString NewDoneColumnId = Board.Columns.Num() > 0 ? Board.Columns.Last().ColumnId : FString();
+    if (NewDoneColumnId != DoneColumnId)
+    {
+        Reset();
+        DoneColumnId = NewDoneColumnId;
+    }
+
+    ProjectId = Board.ProjectId;
+    Columns = Board.Columns;
+
+    TSet<FString> ItemIds;
+    ItemIds.Reserve(Board.Items.Num());
+    for (const FProjectItem& Item : Board.Items)
+    {
+        ItemIds.Add(Item.ItemId);
+        UpdateItem(Item, Now);
+    }
+
+    for (auto It = Records.CreateIterator(); It; ++It)
+    {
+        if (!ItemIds.Contains(It.Key()))
+        {
+            AddState(It.Value(), -1);
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FGitHubBoardAnalytics::UpdateItem(const FProjectItem& Item, const FDateTime& Now)
+{
+    const int32 DueDay = Item.EndDateTime != FDateTime() ? DayOf(Item.EndDateTime) : INDEX_NONE;
+    const bool bDone = !DoneColumnId.IsEmpty() && Item.ColumnId == DoneColumnId;
+
+    FItemRecord* Record = Records.Find(Item.ItemId);
+    if (!Record)
+    {
+        FItemRecord& Created = Records.Add(Item.ItemId);
+        Created.ColumnId = Item.ColumnId;
+        Created.EnteredColumnAt = Now;
+        Created.DueDay = DueDay;
+        if (!FDateTime::ParseIso8601(*Item.CreatedAt, Created.CreatedAt))
+        {
+            Created.CreatedAt = Now;
+        }
+
+        // Done before it was first seen, its last update is the closest guess for the burndown
+        if (bDone)
+        {
+            FDateTime UpdatedAt;
+            Created.CompletedDay = DayOf(FDateTime::ParseIso8601(*Item.UpdatedAt, UpdatedAt) ? UpdatedAt : Now);
+        }
+
+        AddState(Created, 1);
+        return;
+    }
+
+    AddState(*Record, -1);
+
+    if (Record->ColumnId != Item.ColumnId)
+    {
+        // The stay in the column left is over
+        const double Hours = FMath::Max(0.0, (Now - Record->EnteredColumnAt).GetTotalHours());
+        FColumnStats& Stats = FindOrAddColumn(Record->ColumnId);
+        Stats.CompletedStays++;
+        Stats.TotalHours += Hours;
+        Stats.MaxHours = FMath::Max(Stats.MaxHours, Hours);
+        Stats.Histogram[BucketOf(Hours)]++;
+
+        Record->ColumnId = Item.ColumnId;
+        Record->EnteredColumnAt = Now;
+    }
+
+    const bool bWasDone = Record->CompletedDay != INDEX_NONE;
+    if (bDone && !bWasDone)
+    {
+        Record->CompletedDay = DayOf(Now);
+        Record->CycleHours = FMath::Max(0.0, (Now - Record->CreatedAt).GetTotalHours());
+        AddCompletion(*Record, 1);
+    }
+    else if (!bDone && bWasDone)
+    {
+        // Reopened, the completion no longer counts
+        if (Record->CycleHours >= 0.0)
+        {
+            AddCompletion(*Record, -1);
+        }
+        Record->CompletedDay = INDEX_NONE;
+        Record->CycleHours = -1.0;
+    }
+
+    Record->DueDay = DueDay;
+    AddState(*Record, 1);
+}
+
+void FGitHubBoardAnalytics::RemoveItem(const FString& ItemId)
+{
+    // Stays and completions already counted are history and stay
+    FItemRecord Record;
+    if (Records.RemoveAndCopyValue(ItemId, Record))
+    {
+        AddState(Record, -1);
+    }
+}
+
+FGitHubBoardMetrics FGitHubBoardAnalytics::GetMetrics() const
+{
+    FGitHubBoardMetrics Metrics;
+    Metrics.ProjectId = ProjectId;
+    Metrics.HistogramBoundsHours = TArray<float>(HistogramBoundsHours, UE_ARRAY_COUNT(HistogramBoundsHours));
+
+    for (const FColumnInfo& Column : Columns)
+    {
+        FGitHubColumnTimeStats& Out = Metrics.Columns.AddDefaulted_GetRef();
+        Out.ColumnId = Column.ColumnId;
+        Out.ColumnName = Column.ColumnName;
+        Out.Histogram.SetNumZeroed(NumHistogramBuckets);
+
+        if (const FColumnStats* Stats = ColumnStats.Find(Column.ColumnId))
+        {
+            Out.ItemCount = Stats->ItemCount;
+            Out.CompletedStays = Stats->CompletedStays;
+            Out.AverageHours = Stats->CompletedStays > 0 ? float(Stats->TotalHours / Stats->CompletedStays) : 0.0f;
+            Out.MaxHours = float(Stats->MaxHours);
+            Out.Histogram = Stats->Histogram;
+        }
+    }
+
+    Metrics.CycleTimeItems = CycleTimeItems;
+    Metrics.AverageCycleTimeHours = CycleTimeItems > 0 ? float(CycleTimeTotalHours / CycleTimeItems) : 0.0f;
+    Metrics.CycleTimeHistogram = CycleTimeHistogram;
+    Metrics.CycleTimeHistogram.SetNumZeroed(NumHistogramBuckets);
+
+    TArray<int32> Weeks;
+    ThroughputByWeek.GenerateKeyArray(Weeks);
+    Weeks.Sort();
+    for (int32 Week : Weeks)
+    {
+        FGitHubThroughputWeek& Out = Metrics.Throughput.AddDefaulted_GetRef();
+        Out.WeekStart = FDateTime(int64(Week) * ETimespan::TicksPerDay);
+        Out.CompletedItems = ThroughputByWeek[Week];
+    }
+
+    // One point for every day on which an item is due or got done, the remaining counts only change there
+    Metrics.BurndownScope = BurndownScope;
+    TArray<int32> Days;
+    DueByDay.GenerateKeyArray(Days);
+    for (const TPair<int32, int32>& Done : DoneByDay)
+    {
+        if (!DueByDay.Contains(Done.Key))
+        {
+            Days.Add(Done.Key);
+        }
+    }
+    Days.Sort();
+
+    int32 PlannedRemaining = BurndownScope;
+    int32 ActualRemaining = BurndownScope;
+    Metrics.Burndown.Reserve(Days.Num());
+    for (int32 Day : Days)
+    {
+        PlannedRemaining -= DueByDay.FindRef(Day);
+        ActualRemaining -= DoneByDay.FindRef(Day);
+
+        FGitHubBurndownPoint& Out = Metrics.Burndown.AddDefaulted_GetRef();
+        Out.Day = FDateTime(int64(Day) * ETimespan::TicksPerDay);
+        Out.PlannedRemaining = PlannedRemaining;
+        Out.ActualRemaining = ActualRemaining;
+    }
+
+    return Metrics;
+}
+
+void FGitHubBoardAnalytics::Reset()
+{
+    Records.Reset();
+    ColumnStats.Reset();
+    ThroughputByWeek.Reset();
+    CycleTimeItems = 0;
+    CycleTimeTotalHours = 0.0;
+    CycleTimeHistogram.Reset();
+    BurndownScope = 0;
+    DueByDay.Reset();
+    DoneByDay.Reset();
+}
+
+void FGitHubBoardAnalytics::AddState(const FItemRecord& Record, int32 Sign)
+{
+    FindOrAddColumn(Record.ColumnId).ItemCount += Sign;
+
+    // The burndown only follows items with an EndDate
+    if (Record.DueDay != INDEX_NONE)
+    {
+        BurndownScope += Sign;
+        AddCount(DueByDay, Record.DueDay, Sign);
+        if (Record.CompletedDay != INDEX_NONE)
+        {
+            AddCount(DoneByDay, Record.CompletedDay, Sign);
+        }
+    }
+}
+
+void FGitHubBoardAnalytics::AddCompletion(const FItemRecord& Record, int32 Sign)
+{
+    AddCount(ThroughputByWeek, WeekOf(Record.CompletedDay), Sign);
+
+    CycleTimeHistogram.SetNumZeroed(NumHistogramBuckets);
+    CycleTimeHistogram[BucketOf(Record.CycleHours)] += Sign;
+    CycleTimeItems += Sign;
+    CycleTimeTotalHours += Sign * Record.CycleHours;
+}
+
+FGitHubBoardAnalytics::FColumnStats& FGitHubBoardAnalytics::FindOrAddColumn(const FString& ColumnId)
+{
+    FColumnStats& Stats = ColumnStats.FindOrAdd(ColumnId);
+    if (Stats.Histogram.Num() == 0)
+    {
+        Stats.Histogram.SetNumZeroed(NumHistogramBuckets);
+    }
+    return Stats;
+}
+
+int32 FGitHubBoardAnalytics::DayOf(const FDateTime& Date)
+{
+    return int32(Date.GetTicks() / ETimespan::TicksPerDay);
+}
+
+int32 FGitHubBoardAnalytics::WeekOf(int32 Day)
+{
+    // Weeks start on Monday
+    const FDateTime Date(int64(Day) * ETimespan::TicksPerDay);
+    return Day - int32(Date.GetDayOfWeek());
+}
+
+int32 FGitHubBoardAnalytics::BucketOf(double Hours)
+{
+    int32 Bucket = 0;
+    while (Bucket < NumHistogramBuckets - 1 && Hours >= HistogramBoundsHours[Bucket])
+    {
+        ++Bucket;
+    }
+    return Bucket;
+}
+
+void FGitHubBoardAnalytics::AddCount(TMap<int32, int32>& Counts, int32 Key, int32 Delta)
+{
+    int32& Count = Counts.FindOrAdd(Key);
+    Count += Delta;
+    if (Count <= 0)
+    {
+        Counts.Remove(Key);
+    }
+}
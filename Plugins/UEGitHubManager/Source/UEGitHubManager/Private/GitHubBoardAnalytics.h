@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UGitHubAPIManager.h"
+
+/**
+ * Flow metrics of one project: time spent per column, weekly throughput, cycle time and burndown against EndDate.
+ *
+ * Every item keeps a small record of its column, when it entered it, its due day and its completion day. An item
+ * change only takes the old record out of the running counts and adds the new one, and a move closes one stay in
+ * the histogram of the column left, so no metric is ever recomputed over all items. Stays and completions are
+ * measured from the changes seen since the board was first loaded this session, and the last column of the board
+ * counts as done. Game thread only.
+ */
+class FGitHubBoardAnalytics
+{
+public:
+	// Takes the board as it is, items that differ from their record count as changed at Now
+	void SyncBoard(const FProjectInfo& Board, const FDateTime& Now);
+
+	// Item created, moved or edited at Now
+	void UpdateItem(const FProjectItem& Item, const FDateTime& Now);
+	void RemoveItem(const FString& ItemId);
+
+	FGitHubBoardMetrics GetMetrics() const;
+
+private:
+	struct FItemRecord
+	{
+		FString ColumnId;
+		FDateTime EnteredColumnAt;
+		FDateTime CreatedAt;
+		int32 DueDay = INDEX_NONE;
+		int32 CompletedDay = INDEX_NONE;
+
+		// Set when the completion was observed and counted in throughput and cycle time
+		double CycleHours = -1.0;
+	};
+
+	struct FColumnStats
+	{
+		int32 ItemCount = 0;
+		int32 CompletedStays = 0;
+		double TotalHours = 0.0;
+		double MaxHours = 0.0;
+		TArray<int32> Histogram;
+	};
+
+	void Reset();
+	void AddState(const FItemRecord& Record, int32 Sign);
+	void AddCompletion(const FItemRecord& Record, int32 Sign);
+	FColumnStats& FindOrAddColumn(const FString& ColumnId);
+
+	static int32 DayOf(const FDateTime& Date);
+	static int32 WeekOf(int32 Day);
+	static int32 BucketOf(double Hours);
+	static void AddCount(TMap<int32, int32>& Counts, int32 Key, int32 Delta);
+
+	FString ProjectId;
+	TArray<FColumnInfo> Columns;
+	FString DoneColumnId;
+
+	TMap<FString, FItemRecord> Records;
+	TMap<FString, FColumnStats> ColumnStats;
+
+	// Observed completions by the first day of their week
+	TMap<int32, int32> ThroughputByWeek;
+	int32 CycleTimeItems = 0;
+	double CycleTimeTotalHours = 0.0;
+	TArray<int32> CycleTimeHistogram;
+
+	// Items with an EndDate by due day and, once done, by completion day
+	int32 BurndownScope = 0;
+	TMap<int32, int32> DueByDay;
+	TMap<int32, int32> DoneByDay;
+};
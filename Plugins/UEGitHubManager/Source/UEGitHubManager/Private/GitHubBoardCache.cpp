@@ -0,0 +1,226 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubBoardCache.h"
+#include "UGitHubAPIManager.h"
+#include "GitHubBoardDiff.h"
+#include "GitHubTrace.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+    constexpr uint32 SpillMagic = 0x47484243; // "GHBC"
+    constexpr int32 SpillVersion = 1;
+
+    int64 GetStringBytes(std::initializer_list<const FString*> Strings)
+    {
+        int64 Bytes = 0;
+        for (const FString* Text : Strings)
+        {
+            Bytes += Text->GetAllocatedSize();
+        }
+        return Bytes;
+    }
+}
+
+FGitHubBoardCache::FGitHubBoardCache(const FString& InSpillDirectory)
+    : SpillDirectory(InSpillDirectory)
+    , PendingWrites(MakeShared<FPendingWrites, ESPMode::ThreadSafe>())
+{
+}
+
+void FGitHubBoardCache::ClearSpillFiles()
+{
+    IFileManager::Get().DeleteDirectory(*SpillDirectory, false, true);
+    SpilledProjects.Reset();
+}
+
+void FGitHubBoardCache::Touch(const FString& ProjectId, int64 Bytes)
+{
+    FEntry& Entry = Entries.FindOrAdd(ProjectId);
+    Entry.LastUse = ++UseCounter;
+    if (Bytes >= 0)
+    {
+        ResidentBytes += Bytes - Entry.Bytes;
+        Entry.Bytes = Bytes;
+    }
+}
+
+void FGitHubBoardCache::Remove(const FString& ProjectId)
+{
+    FEntry Entry;
+    if (Entries.RemoveAndCopyValue(ProjectId, Entry))
+    {
+        ResidentBytes -= Entry.Bytes;
+    }
+}
+
+TArray<FString> FGitHubBoardCache::SelectEvictions(int64 BudgetBytes, TFunctionRef<bool(const FString&)> IsPinned) const
+{
+    TArray<FString> Evictions;
+    if (ResidentBytes <= BudgetBytes || Entries.Num() < 2)
+    {
+        return Evictions;
+    }
+
+    TArray<TPair<uint64, FString>> ByLastUse;
+    ByLastUse.Reserve(Entries.Num());
+    for (const TPair<FString, FEntry>& Entry : Entries)
+    {
+        ByLastUse.Emplace(Entry.Value.LastUse, Entry.Key);
+    }
+    ByLastUse.Sort([](const TPair<uint64, FString>& A, const TPair<uint64, FString>& B) { return A.Key < B.Key; });
+
+    int64 Bytes = ResidentBytes;
+    for (int32 Index = 0; Index < ByLastUse.Num() - 1 && Bytes > BudgetBytes; ++Index)
+    {
+        const FString& ProjectId = ByLastUse[Index].Value;
+        if (!IsPinned(ProjectId))
+        {
+            Bytes -= Entries[ProjectId].Bytes;
+            Evictions.Add(ProjectId);
+        }
+    }
+    return Evictions;
+}
+
+void FGitHubBoardCache::Spill(const TSharedRef<FProjectInfo, ESPMode::ThreadSafe>& Board)
+{
+    const FString ProjectId = Board->ProjectId;
+    const FString SpillPath = GetSpillPath(ProjectId);
+    const FString TempPath = FString::Printf(TEXT("%s.%llu.tmp"), *SpillPath, ++SpillCounter);
+    SpilledProjects.Add(ProjectId);
+    {
+        FScopeLock ScopeLock(&PendingWrites->Lock);
+        PendingWrites->Boards.Add(ProjectId, Board);
+    }
+
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [PendingWrites = PendingWrites, Board, ProjectId, SpillPath, TempPath]()
+        {
+            GITHUB_TRACE_SCOPE(GitHub_SpillBoard);
+
+            TArray<uint8> Bytes;
+            FMemoryWriter Writer(Bytes, true);
+            uint32 Magic = SpillMagic;
+            int32 Version = SpillVersion;
+            Writer << Magic << Version;
+            FProjectInfo::StaticStruct()->SerializeItem(Writer, &Board.Get(), nullptr);
+
+            const bool bWritten = FFileHelper::SaveArrayToFile(Bytes, *TempPath);
+
+            // Only the latest spill of a board that was not restored meanwhile may replace the file
+            FScopeLock ScopeLock(&PendingWrites->Lock);
+            const TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* Pending = PendingWrites->Boards.Find(ProjectId);
+            if (Pending && *Pending == Board)
+            {
+                if (bWritten && IFileManager::Get().Move(*SpillPath, *TempPath, true, true))
+                {
+                    PendingWrites->Boards.Remove(ProjectId);
+                    return;
+                }
+
+                // The board stays in memory rather than being lost
+                UE_LOG(LogTemp, Error, TEXT("Board of project %s could not be written to %s, it stays in memory."), *ProjectId, *SpillPath);
+            }
+            IFileManager::Get().Delete(*TempPath, false, false, true);
+        });
+}
+
+TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> FGitHubBoardCache::Restore(const FString& ProjectId)
+{
+    if (!SpilledProjects.Remove(ProjectId))
+    {
+        return nullptr;
+    }
+
+    const FString SpillPath = GetSpillPath(ProjectId);
+    {
+        FScopeLock ScopeLock(&PendingWrites->Lock);
+        TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Pending;
+        if (PendingWrites->Boards.RemoveAndCopyValue(ProjectId, Pending))
+        {
+            return Pending;
+        }
+    }
+
+    GITHUB_TRACE_SCOPE(GitHub_RestoreBoard);
+
+    TArray<uint8> Bytes;
+    const bool bLoaded = FFileHelper::LoadFileToArray(Bytes, *SpillPath, FILEREAD_Silent);
+    IFileManager::Get().Delete(*SpillPath, false, false, true);
+    if (!bLoaded)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Spilled board of project %s is missing, it is loaded from GitHub again."), *ProjectId);
+        return nullptr;
+    }
+
+    FMemoryReader Reader(Bytes, true);
+    uint32 Magic = 0;
+    int32 Version = 0;
+    Reader << Magic << Version;
+    if (Magic != SpillMagic || Version != SpillVersion)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Spilled board of project %s has an unknown format, it is loaded from GitHub again."), *ProjectId);
+        return nullptr;
+    }
+
+    TSharedRef<FProjectInfo, ESPMode::ThreadSafe> Board = MakeShared<FProjectInfo, ESPMode::ThreadSafe>();
+    FProjectInfo::StaticStruct()->SerializeItem(Reader, &Board.Get(), nullptr);
+    if (Reader.IsError())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Spilled board of project %s is damaged, it is loaded from GitHub again."), *ProjectId);
+        return nullptr;
+    }
+
+    // The content hash is not a property and does not survive the round trip
+    for (FProjectItem& Item : Board->Items)
+    {
+        Item.ContentHash = GitHubBoardDiff::HashItemContent(Item);
+    }
+    return Board;
+}
+
+void FGitHubBoardCache::Discard(const FString& ProjectId)
+{
+    if (!SpilledProjects.Remove(ProjectId))
+    {
+        return;
+    }
+
+    {
+        FScopeLock ScopeLock(&PendingWrites->Lock);
+        PendingWrites->Boards.Remove(ProjectId);
+    }
+    IFileManager::Get().Delete(*GetSpillPath(ProjectId), false, false, true);
+}
+
+int64 FGitHubBoardCache::EstimateFootprint(const FProjectInfo& Board)
+{
+    int64 Bytes = sizeof(FProjectInfo) + Board.Columns.GetAllocatedSize() + Board.Items.GetAllocatedSize();
+    Bytes += GetStringBytes({ &Board.ProjectId, &Board.ProjectTitle, &Board.ProjectDescription, &Board.ProjectURL, &Board.OwnerLogin,
+        &Board.ColumnFieldId, &Board.StartDateFieldId, &Board.EndDateFieldId });
+
+    for (const FColumnInfo& Column : Board.Columns)
+    {
+        Bytes += GetStringBytes({ &Column.ColumnId, &Column.ColumnName });
+    }
+
+    for (const FProjectItem& Item : Board.Items)
+    {
+        Bytes += GetStringBytes({ &Item.ItemId, &Item.Title, &Item.Url, &Item.Type, &Item.State, &Item.CreatedAt, &Item.Body,
+            &Item.ColumnId, &Item.ColumnName, &Item.StartDate, &Item.EndDate, &Item.StartDateFieldId, &Item.EndDateFieldId,
+            &Item.ContentId, &Item.UpdatedAt });
+    }
+    return Bytes;
+}
+
+FString FGitHubBoardCache::GetSpillPath(const FString& ProjectId) const
+{
+    return SpillDirectory / FPaths::MakeValidFileName(ProjectId) + TEXT(".board");
+}
@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+struct FProjectInfo;
+
+/**
+ * Memory accounting of the loaded boards and their spill files.
+ *
+ * Tracks the footprint and last use of every board the manager holds and picks the least recently used ones
+ * to evict once they exceed a budget. Evicted boards are written to one file per project on a background worker
+ * and read back synchronously when their project is needed again; until its file is complete a board is
+ * restored from memory. Game thread only.
+ */
+class FGitHubBoardCache
+{
+public:
+	explicit FGitHubBoardCache(const FString& InSpillDirectory);
+
+	// Deletes the spill files of an earlier session, their boards are outdated by now
+	void ClearSpillFiles();
+
+	// Marks the project as most recently used, a Bytes value of zero or more replaces its footprint
+	void Touch(const FString& ProjectId, int64 Bytes = -1);
+	void Remove(const FString& ProjectId);
+
+	// Least recently used projects to evict until the rest fits into BudgetBytes, the most recently used one always stays
+	TArray<FString> SelectEvictions(int64 BudgetBytes, TFunctionRef<bool(const FString&)> IsPinned) const;
+
+	int64 GetResidentBytes() const { return ResidentBytes; }
+	int32 NumResident() const { return Entries.Num(); }
+
+	void Spill(const TSharedRef<FProjectInfo, ESPMode::ThreadSafe>& Board);
+	bool IsSpilled(const FString& ProjectId) const { return SpilledProjects.Contains(ProjectId); }
+	int32 NumSpilled() const { return SpilledProjects.Num(); }
+
+	// The spilled board of the project, null if there is none or its file could not be read
+	TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Restore(const FString& ProjectId);
+
+	// Forgets the spilled board of a project that was loaded again from GitHub
+	void Discard(const FString& ProjectId);
+
+	static int64 EstimateFootprint(const FProjectInfo& Board);
+
+private:
+	struct FEntry
+	{
+		int64 Bytes = 0;
+		uint64 LastUse = 0;
+	};
+
+	// Boards whose file is still being written, shared with the writing workers
+	struct FPendingWrites
+	{
+		FCriticalSection Lock;
+		TMap<FString, TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>> Boards;
+	};
+
+	FString GetSpillPath(const FString& ProjectId) const;
+
+	FString SpillDirectory;
+	TMap<FString, FEntry> Entries;
+	uint64 UseCounter = 0;
+	int64 ResidentBytes = 0;
+
+	TSet<FString> SpilledProjects;
+	TSharedRef<FPendingWrites, ESPMode::ThreadSafe> PendingWrites;
+	uint64 SpillCounter = 0;
+};
@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubBoardDiff.h"
+#include "UGitHubAPIManager.h"
+#include "Hash/CityHash.h"
+
+namespace
+{
+    // GetTypeHash(FString) ignores case and 32 bits collide too often on large boards, a fixed title
+    // casing must still count as a change
+    uint64 HashField(const FString& Field, uint64 Seed)
+    {
+        return CityHash64WithSeed(reinterpret_cast<const char*>(*Field), uint32(Field.Len() * sizeof(TCHAR)), Seed);
+    }
+}
+
+uint64 GitHubBoardDiff::HashItemContent(const FProjectItem& Item)
+{
+    uint64 Hash = HashField(Item.Title, 0);
+    Hash = HashField(Item.Url, Hash);
+    Hash = HashField(Item.Type, Hash);
+    Hash = HashField(Item.State, Hash);
+    Hash = HashField(Item.CreatedAt, Hash);
+    Hash = HashField(Item.Body, Hash);
+    Hash = HashField(Item.StartDate, Hash);
+    return HashField(Item.EndDate, Hash);
+}
+
+void GitHubBoardDiff::Compute(const FProjectInfo& OldBoard, const FProjectInfo& NewBoard, FGitHubBoardDiff& OutDiff)
+{
+    TMap<FString, int32> OldIndexById;
+    OldIndexById.Reserve(OldBoard.Items.Num());
+    for (int32 Index = 0; Index < OldBoard.Items.Num(); ++Index)
+    {
+        OldIndexById.Add(OldBoard.Items[Index].ItemId, Index);
+    }
+
+    TBitArray<> Matched(false, OldBoard.Items.Num());
+    for (int32 Index = 0; Index < NewBoard.Items.Num(); ++Index)
+    {
+        const FProjectItem& NewItem = NewBoard.Items[Index];
+        const int32* OldIndex = OldIndexById.Find(NewItem.ItemId);
+        if (!OldIndex)
+        {
+            OutDiff.Added.Add(Index);
+            continue;
+        }
+
+        Matched[*OldIndex] = true;
+        const FProjectItem& OldItem = OldBoard.Items[*OldIndex];
+
+        if (OldItem.ColumnId != NewItem.ColumnId)
+        {
+            FGitHubBoardDiff::FMove& Move = OutDiff.Moved.AddDefaulted_GetRef();
+            Move.ItemIndex = Index;
+            Move.FromColumnId = OldItem.ColumnId;
+        }
+
+        if (OldItem.ContentHash != NewItem.ContentHash)
+        {
+            OutDiff.Changed.Add(Index);
+        }
+    }
+
+    for (int32 Index = 0; Index < OldBoard.Items.Num(); ++Index)
+    {
+        if (!Matched[Index])
+        {
+            OutDiff.Removed.Add(OldBoard.Items[Index].ItemId);
+        }
+    }
+}
+
+bool GitHubBoardDiff::HaveSameColumns(const FProjectInfo& OldBoard, const FProjectInfo& NewBoard)
+{
+    if (OldBoard.ColumnFieldId != NewBoard.ColumnFieldId || OldBoard.Columns.Num() != NewBoard.Columns.Num())
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < OldBoard.Columns.Num(); ++Index)
+    {
+        if (OldBoard.Columns[Index].ColumnId != NewBoard.Columns[Index].ColumnId || OldBoard.Columns[Index].ColumnName != NewBoard.Columns[Index].ColumnName)
+        {
+            return false;
+        }
+    }
+    return true;
+}
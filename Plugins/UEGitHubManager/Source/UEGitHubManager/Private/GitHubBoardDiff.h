@@ -0,0 +1,42 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FProjectItem;
+struct FProjectInfo;
+
+/**
+ * Item-level difference between two versions of a project board.
+ * Indices refer to the Items array of the board they were taken from.
+ */
+struct FGitHubBoardDiff
+{
+	struct FMove
+	{
+		int32 ItemIndex = INDEX_NONE;
+		FString FromColumnId;
+	};
+
+	// Indices into the new board
+	TArray<int32> Added;
+	TArray<int32> Changed;
+	TArray<FMove> Moved;
+
+	// Item IDs that only exist in the old board
+	TArray<FString> Removed;
+
+	bool IsEmpty() const { return Added.Num() == 0 && Changed.Num() == 0 && Moved.Num() == 0 && Removed.Num() == 0; }
+};
+
+namespace GitHubBoardDiff
+{
+	// Case-sensitive hash of everything shown on a card except its column, column changes are reported as moves
+	uint64 HashItemContent(const FProjectItem& Item);
+
+	// Compares by ItemId and ContentHash, both boards need their hashes filled in
+	void Compute(const FProjectInfo& OldBoard, const FProjectInfo& NewBoard, FGitHubBoardDiff& OutDiff);
+
+	bool HaveSameColumns(const FProjectInfo& OldBoard, const FProjectInfo& NewBoard);
+}
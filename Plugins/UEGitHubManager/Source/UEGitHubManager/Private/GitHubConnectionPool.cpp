@@ -0,0 +1,166 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubConnectionPool.h"
+#include "Async/Async.h"
+
+void FGitHubConnectionPool::SetSettings(const FGitHubConnectionSettings& InSettings)
+{
+    Settings = InSettings;
+    Settings.MaxConnections = FMath::Max(1, Settings.MaxConnections);
+
+    TrimIdleConnections(FPlatformTime::Seconds());
+    Pump();
+}
+
+void FGitHubConnectionPool::Submit(TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request, EGitHubRequestPriority Priority)
+{
+    if (!IsInGameThread())
+    {
+        AsyncTask(ENamedThreads::GameThread, [WeakPool = AsWeak(), Request, Priority]()
+            {
+                if (TSharedPtr<FGitHubConnectionPool, ESPMode::ThreadSafe> Pool = WeakPool.Pin())
+                {
+                    Pool->Submit(Request, Priority);
+                }
+            });
+        return;
+    }
+
+    // Chain the release in front of the caller's completion so the slot is free before its handler runs
+    FHttpRequestCompleteDelegate Completion = Request->OnProcessRequestComplete();
+    Request->OnProcessRequestComplete().BindLambda([WeakPool = AsWeak(), Completion, Priority](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bWasSuccessful)
+        {
+            if (TSharedPtr<FGitHubConnectionPool, ESPMode::ThreadSafe> Pool = WeakPool.Pin())
+            {
+                Pool->Release(ResponsePtr, Priority);
+            }
+            Completion.ExecuteIfBound(RequestPtr, ResponsePtr, bWasSuccessful);
+        });
+
+    if (Priority == EGitHubRequestPriority::Background)
+    {
+        BackgroundRequests.Add(Request);
+    }
+    else
+    {
+        PendingRequests.Add(Request);
+    }
+    Pump();
+}
+
+void FGitHubConnectionPool::Cancel(TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request)
+{
+    if (!IsInGameThread())
+    {
+        AsyncTask(ENamedThreads::GameThread, [WeakPool = AsWeak(), Request]()
+            {
+                if (TSharedPtr<FGitHubConnectionPool, ESPMode::ThreadSafe> Pool = WeakPool.Pin())
+                {
+                    Pool->Cancel(Request);
+                }
+            });
+        return;
+    }
+
+    // A queued request never took a slot, so it must not run the chained release either
+    if (PendingRequests.Remove(Request) > 0 || BackgroundRequests.Remove(Request) > 0)
+    {
+        Stats.CancelledRequests++;
+        return;
+    }
+
+    // Finished requests are left alone, their response is dropped by the caller
+    if (Request->GetStatus() == EHttpRequestStatus::Processing)
+    {
+        Stats.CancelledRequests++;
+        Request->CancelRequest();
+    }
+}
+
+FGitHubConnectionStats FGitHubConnectionPool::GetStats() const
+{
+    FGitHubConnectionStats Result = Stats;
+    Result.ActiveConnections = ActiveConnections;
+    Result.IdleConnections = IdleConnections.Num();
+    Result.QueuedRequests = PendingRequests.Num() + BackgroundRequests.Num();
+    Result.ReuseRate = Stats.RequestsDispatched > 0 ? float(Stats.ReusedConnections) / Stats.RequestsDispatched : 0.0f;
+    return Result;
+}
+
+void FGitHubConnectionPool::Pump()
+{
+    const double Now = FPlatformTime::Seconds();
+    TrimIdleConnections(Now);
+
+    // Background work never holds the last free connection, so a click is not stuck behind a prefetch
+    const int32 MaxBackgroundConnections = FMath::Max(1, Settings.MaxConnections - 1);
+
+    while (ActiveConnections < Settings.MaxConnections)
+    {
+        TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>>* Queue = &PendingRequests;
+        if (PendingRequests.Num() == 0)
+        {
+            if (BackgroundRequests.Num() == 0 || ActiveConnections >= MaxBackgroundConnections)
+            {
+                break;
+            }
+            Queue = &BackgroundRequests;
+        }
+
+        TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = (*Queue)[0];
+        Queue->RemoveAt(0, 1, EAllowShrinking::No);
+
+        if (IdleConnections.Num() > 0)
+        {
+            // Most recently released connection is the least likely to have been closed by the server
+            IdleConnections.Pop(EAllowShrinking::No);
+            Stats.ReusedConnections++;
+        }
+        else
+        {
+            Stats.NewConnections++;
+        }
+
+        Stats.RequestsDispatched++;
+        ActiveConnections++;
+        Request->ProcessRequest();
+    }
+}
+
+void FGitHubConnectionPool::Release(FHttpResponsePtr Response, EGitHubRequestPriority Priority)
+{
+    if (Response.IsValid())
+    {
+        if (Priority == EGitHubRequestPriority::Background)
+        {
+            Stats.BackgroundBytes += Response->GetContent().Num();
+        }
+
+        // GraphQL responses carry the points left in the current rate limit window, REST has a separate limit
+        const FString Remaining = Response->GetHeader(TEXT("x-ratelimit-remaining"));
+        const FString Limit = Response->GetHeader(TEXT("x-ratelimit-limit"));
+        if (Response->GetHeader(TEXT("x-ratelimit-resource")) == TEXT("graphql") && !Remaining.IsEmpty() && !Limit.IsEmpty())
+        {
+            Stats.RateLimitRemaining = FCString::Atoi(*Remaining);
+            Stats.RateLimitLimit = FCString::Atoi(*Limit);
+        }
+    }
+
+    ActiveConnections = FMath::Max(0, ActiveConnections - 1);
+    IdleConnections.Add(FPlatformTime::Seconds());
+    Pump();
+}
+
+void FGitHubConnectionPool::TrimIdleConnections(double Now)
+{
+    IdleConnections.RemoveAll([this, Now](double ReleasedAt)
+        {
+            return Now - ReleasedAt > Settings.KeepAliveSeconds;
+        });
+
+    while (IdleConnections.Num() + ActiveConnections > Settings.MaxConnections && IdleConnections.Num() > 0)
+    {
+        IdleConnections.RemoveAt(0);
+    }
+}
@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "UGitHubAPIManager.h"
+
+/**
+ * Dispatches requests to api.github.com over a bounded set of keep-alive connections.
+ *
+ * The HTTP backend keeps finished connections in its own cache, so bounding concurrency is what makes
+ * bursts reuse warm connections instead of opening parallel ones. Connection reuse is tracked on our
+ * side: a connection released within the keep-alive window counts as warm for the next request.
+ *
+ * Background requests wait until no normal request is queued and leave one connection free for them.
+ *
+ * Game thread only; Submit marshals calls from other threads.
+ */
+class FGitHubConnectionPool : public TSharedFromThis<FGitHubConnectionPool, ESPMode::ThreadSafe>
+{
+public:
+	void SetSettings(const FGitHubConnectionSettings& InSettings);
+
+	void Submit(TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request, EGitHubRequestPriority Priority = EGitHubRequestPriority::Normal);
+
+	// Drops a request that is still waiting for a connection, or cancels it on the wire
+	void Cancel(TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request);
+
+	FGitHubConnectionStats GetStats() const;
+
+private:
+	void Pump();
+	void Release(FHttpResponsePtr Response, EGitHubRequestPriority Priority);
+	void TrimIdleConnections(double Now);
+
+	FGitHubConnectionSettings Settings;
+
+	TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>> PendingRequests;
+	TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>> BackgroundRequests;
+
+	// Release time of every connection that is currently idle but still inside the keep-alive window
+	TArray<double> IdleConnections;
+
+	int32 ActiveConnections = 0;
+	FGitHubConnectionStats Stats;
+};
@@ -0,0 +1,134 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubDashboard.h"
+
+namespace
+{
+    // Items without a status are counted under this column name
+    const TCHAR* NoStatusColumn = TEXT("No Status");
+}
+
+void FGitHubDashboard::SetProjects(const TArray<FString>& ProjectIds)
+{
+    TMap<FString, FGitHubProjectCounts> Previous = MoveTemp(CountsByProject);
+    CountsByProject.Reset();
+    ProjectOrder.Reset();
+    TotalItems = 0;
+    TotalColumns.Reset();
+    TotalStates.Reset();
+
+    for (const FString& ProjectId : ProjectIds)
+    {
+        if (CountsByProject.Contains(ProjectId))
+        {
+            continue;
+        }
+
+        ProjectOrder.Add(ProjectId);
+        FGitHubProjectCounts Counts;
+        if (Previous.RemoveAndCopyValue(ProjectId, Counts))
+        {
+            Accumulate(Counts, 1);
+        }
+        else
+        {
+            Counts.ProjectId = ProjectId;
+        }
+        CountsByProject.Add(ProjectId, MoveTemp(Counts));
+    }
+}
+
+void FGitHubDashboard::SetProjectCounts(const FGitHubProjectCounts& Counts)
+{
+    FGitHubProjectCounts* Existing = CountsByProject.Find(Counts.ProjectId);
+    if (!Existing)
+    {
+        return;
+    }
+
+    Accumulate(*Existing, -1);
+    *Existing = Counts;
+    Accumulate(*Existing, 1);
+}
+
+void FGitHubDashboard::MoveItem(const FString& ProjectId, const FString& FromColumnName, const FString& ToColumnName)
+{
+    FGitHubProjectCounts* Counts = CountsByProject.Find(ProjectId);
+    const FString From = FromColumnName.IsEmpty() ? FString(NoStatusColumn) : FromColumnName;
+    const FString To = ToColumnName.IsEmpty() ? FString(NoStatusColumn) : ToColumnName;
+    if (!Counts || From == To)
+    {
+        return;
+    }
+
+    AddCount(Counts->ColumnCounts, From, -1);
+    AddCount(Counts->ColumnCounts, To, 1);
+    AddCount(TotalColumns, From, -1);
+    AddCount(TotalColumns, To, 1);
+}
+
+FGitHubDashboardSummary FGitHubDashboard::GetSummary() const
+{
+    FGitHubDashboardSummary Summary;
+    Summary.ItemCount = TotalItems;
+    Summary.ColumnCounts = TotalColumns;
+    Summary.StateCounts = TotalStates;
+
+    Summary.Projects.Reserve(ProjectOrder.Num());
+    for (const FString& ProjectId : ProjectOrder)
+    {
+        const FGitHubProjectCounts& Counts = CountsByProject[ProjectId];
+        Summary.CompleteProjects += Counts.bComplete ? 1 : 0;
+        Summary.Projects.Add(Counts);
+    }
+    return Summary;
+}
+
+FGitHubProjectCounts FGitHubDashboard::CountBoard(const FProjectInfo& Board)
+{
+    FGitHubProjectCounts Counts;
+    Counts.ProjectId = Board.ProjectId;
+    Counts.ProjectTitle = Board.ProjectTitle;
+    Counts.bComplete = true;
+    for (const FProjectItem& Item : Board.Items)
+    {
+        AddItem(Counts, Item.ColumnName, Item.State);
+    }
+    return Counts;
+}
+
+void FGitHubDashboard::AddItem(FGitHubProjectCounts& Counts, const FString& ColumnName, const FString& State)
+{
+    Counts.ItemCount++;
+    AddCount(Counts.ColumnCounts, ColumnName.IsEmpty() ? FString(NoStatusColumn) : ColumnName, 1);
+
+    // Redacted content has no state, it only counts as an item
+    if (!State.IsEmpty())
+    {
+        AddCount(Counts.StateCounts, State, 1);
+    }
+}
+
+void FGitHubDashboard::Accumulate(const FGitHubProjectCounts& Counts, int32 Sign)
+{
+    TotalItems += Sign * Counts.ItemCount;
+    for (const TPair<FString, int32>& Column : Counts.ColumnCounts)
+    {
+        AddCount(TotalColumns, Column.Key, Sign * Column.Value);
+    }
+    for (const TPair<FString, int32>& State : Counts.StateCounts)
+    {
+        AddCount(TotalStates, State.Key, Sign * State.Value);
+    }
+}
+
+void FGitHubDashboard::AddCount(TMap<FString, int32>& Counts, const FString& Key, int32 Delta)
+{
+    int32& Count = Counts.FindOrAdd(Key);
+    Count += Delta;
+    if (Count <= 0)
+    {
+        Counts.Remove(Key);
+    }
+}
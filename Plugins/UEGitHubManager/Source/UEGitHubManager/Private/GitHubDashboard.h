@@ -0,0 +1,42 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UGitHubAPIManager.h"
+
+/**
+ * Item counts per column and per state of a set of projects, with running totals over all of them.
+ *
+ * Columns are counted by name so the same status adds up across projects. Replacing the counts of one
+ * project only takes its previous counts out of the totals and adds the new ones, and a single move
+ * adjusts two counters, so nothing is ever summed up over all projects again. Game thread only.
+ */
+class FGitHubDashboard
+{
+public:
+	// Makes ProjectIds the tracked projects in this order, counts of projects that stay tracked are kept
+	void SetProjects(const TArray<FString>& ProjectIds);
+
+	bool Contains(const FString& ProjectId) const { return CountsByProject.Contains(ProjectId); }
+	bool IsEmpty() const { return ProjectOrder.Num() == 0; }
+
+	void SetProjectCounts(const FGitHubProjectCounts& Counts);
+	void MoveItem(const FString& ProjectId, const FString& FromColumnName, const FString& ToColumnName);
+
+	FGitHubDashboardSummary GetSummary() const;
+
+	static FGitHubProjectCounts CountBoard(const FProjectInfo& Board);
+	static void AddItem(FGitHubProjectCounts& Counts, const FString& ColumnName, const FString& State);
+
+private:
+	void Accumulate(const FGitHubProjectCounts& Counts, int32 Sign);
+	static void AddCount(TMap<FString, int32>& Counts, const FString& Key, int32 Delta);
+
+	TArray<FString> ProjectOrder;
+	TMap<FString, FGitHubProjectCounts> CountsByProject;
+
+	int32 TotalItems = 0;
+	TMap<FString, int32> TotalColumns;
+	TMap<FString, int32> TotalStates;
+};
@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubEntityCache.h"
+#include "Misc/ScopeRWLock.h"
+#include "UGitHubAPIManager.h"
+
+TSharedPtr<const FGitHubContentEntity, ESPMode::ThreadSafe> FGitHubEntityCache::Find(const FString& Id) const
+{
+    FReadScopeLock ScopeLock(Lock);
+
+    const FGitHubContentEntityRef* Entity = Entities.Find(Id);
+    return Entity ? TSharedPtr<const FGitHubContentEntity, ESPMode::ThreadSafe>(*Entity) : nullptr;
+}
+
+bool FGitHubEntityCache::IsFresh(const FString& Id, const FString& UpdatedAt) const
+{
+    FReadScopeLock ScopeLock(Lock);
+
+    // ISO 8601 timestamps in UTC order like plain strings
+    const FGitHubContentEntityRef* Entity = Entities.Find(Id);
+    return Entity && !UpdatedAt.IsEmpty() && (*Entity)->UpdatedAt >= UpdatedAt;
+}
+
+bool FGitHubEntityCache::Upsert(const FGitHubContentEntityRef& Entity)
+{
+    FWriteScopeLock ScopeLock(Lock);
+
+    FGitHubContentEntityRef* Existing = Entities.Find(Entity->Id);
+    if (!Existing)
+    {
+        Entities.Add(Entity->Id, Entity);
+        return true;
+    }
+
+    const FGitHubContentEntity& Cached = **Existing;
+    const bool bChanged = Cached.Title != Entity->Title || Cached.Url != Entity->Url || Cached.State != Entity->State
+        || Cached.Body != Entity->Body || Cached.Type != Entity->Type || Cached.CreatedAt != Entity->CreatedAt;
+
+    *Existing = Entity;
+    return bChanged;
+}
+
+void FGitHubEntityCache::Prune(TFunctionRef<bool(const FString&)> IsReferenced)
+{
+    FWriteScopeLock ScopeLock(Lock);
+
+    for (auto It = Entities.CreateIterator(); It; ++It)
+    {
+        if (!IsReferenced(It.Key()))
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+int32 FGitHubEntityCache::Num() const
+{
+    FReadScopeLock ScopeLock(Lock);
+    return Entities.Num();
+}
+
+void FGitHubEntityCache::ApplyTo(const FGitHubContentEntity& Entity, FProjectItem& Item)
+{
+    Item.Type = Entity.Type;
+    Item.Title = Entity.Title;
+    Item.Url = Entity.Url;
+    Item.State = Entity.State;
+    Item.CreatedAt = Entity.CreatedAt;
+    Item.UpdatedAt = Entity.UpdatedAt;
+    Item.Body = Entity.Body;
+}
@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+struct FProjectItem;
+
+// Issue, pull request or draft issue as GitHub returns it, independent of the projects it is on
+struct FGitHubContentEntity
+{
+	FString Id;
+	FString Type;
+	FString Title;
+	FString Url;
+	FString State;
+	FString CreatedAt;
+	FString UpdatedAt;
+	FString Body;
+};
+
+using FGitHubContentEntityRef = TSharedRef<const FGitHubContentEntity, ESPMode::ThreadSafe>;
+
+/**
+ * Content nodes by GraphQL id, shared by every loaded board.
+ *
+ * Boards only download the id and updatedAt of their items' content; whatever is missing or older
+ * than that is fetched once and lands here, so an issue on five projects is downloaded once. Entries
+ * are immutable and replaced as a whole, readers keep the version they looked up. Thread-safe.
+ */
+class FGitHubEntityCache
+{
+public:
+	TSharedPtr<const FGitHubContentEntity, ESPMode::ThreadSafe> Find(const FString& Id) const;
+
+	// True if the cached entity is at least as recent as UpdatedAt
+	bool IsFresh(const FString& Id, const FString& UpdatedAt) const;
+
+	// Returns true if the entity was new or differs from the cached one
+	bool Upsert(const FGitHubContentEntityRef& Entity);
+
+	// Drops every entity for which IsReferenced returns false
+	void Prune(TFunctionRef<bool(const FString&)> IsReferenced);
+
+	int32 Num() const;
+
+	// Copies the entity's content into the item's Blueprint-facing fields
+	static void ApplyTo(const FGitHubContentEntity& Entity, FProjectItem& Item);
+
+private:
+	mutable FRWLock Lock;
+	TMap<FString, FGitHubContentEntityRef> Entities;
+};
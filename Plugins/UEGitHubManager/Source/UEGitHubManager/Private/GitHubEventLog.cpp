@@ -0,0 +1,758 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubEventLog.h"
+#include "UGitHubAPIManager.h"
+#include "GitHubTrace.h"
+#include "Algo/BinarySearch.h"
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    constexpr uint32 LogMagic = 0x4748454C; // "GHEL"
+    constexpr uint32 LogVersion = 1;
+    constexpr int64 HeaderSize = 8;
+
+    // Events before a new checkpoint is considered. A segment also has to outgrow its checkpoint, so a large board
+    // is not written out in full every few hundred events and a replay never reads more than twice the checkpoint.
+    constexpr int32 EventsPerCheckpoint = 512;
+
+    enum class EEventKind : uint8
+    {
+        Checkpoint = 1,
+        Created,
+        Moved,
+        DatesChanged,
+        TitleChanged,
+        Removed
+    };
+
+    int64 ToMilliseconds(const FDateTime& Time)
+    {
+        return Time.GetTicks() / ETimespan::TicksPerMillisecond;
+    }
+
+    void WriteVarint(TArray<uint8>& Out, uint64 Value)
+    {
+        while (Value >= 0x80)
+        {
+            Out.Add(uint8(Value) | 0x80);
+            Value >>= 7;
+        }
+        Out.Add(uint8(Value));
+    }
+
+    void WriteFixed(TArray<uint8>& Out, uint64 Value, int32 NumBytes)
+    {
+        for (int32 Index = 0; Index < NumBytes; ++Index)
+        {
+            Out.Add(uint8(Value >> (8 * Index)));
+        }
+    }
+
+    // Bounds checked reads from a log, any read past the end sets bError
+    struct FRecordReader
+    {
+        const uint8* Data = nullptr;
+        int64 Size = 0;
+        int64 Offset = 0;
+        bool bError = false;
+
+        uint64 ReadFixed(int32 NumBytes)
+        {
+            if (Offset + NumBytes > Size)
+            {
+                bError = true;
+                return 0;
+            }
+
+            uint64 Value = 0;
+            for (int32 Index = 0; Index < NumBytes; ++Index)
+            {
+                Value |= uint64(Data[Offset++]) << (8 * Index);
+            }
+            return Value;
+        }
+
+        uint64 ReadVarint()
+        {
+            uint64 Value = 0;
+            for (int32 Shift = 0; Shift < 64; Shift += 7)
+            {
+                if (Offset >= Size)
+                {
+                    break;
+                }
+
+                const uint8 Byte = Data[Offset++];
+                Value |= uint64(Byte & 0x7F) << Shift;
+                if ((Byte & 0x80) == 0)
+                {
+                    return Value;
+                }
+            }
+            bError = true;
+            return 0;
+        }
+
+        // A string is either new to the segment and spelled out, or the index of one seen before in it
+        FString ReadString(TArray<FString>& Strings)
+        {
+            const uint64 Tag = ReadVarint();
+            if (bError)
+            {
+                return FString();
+            }
+
+            if ((Tag & 1) == 0)
+            {
+                const uint64 Index = Tag >> 1;
+                if (Index >= uint64(Strings.Num()))
+                {
+                    bError = true;
+                    return FString();
+                }
+                return Strings[int32(Index)];
+            }
+
+            const uint64 Length = Tag >> 1;
+            if (Length > uint64(Size - Offset))
+            {
+                bError = true;
+                return FString();
+            }
+
+            const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data + Offset), int32(Length));
+            Offset += int64(Length);
+            return Strings.Add_GetRef(FString(Converted.Length(), Converted.Get()));
+        }
+    };
+
+    // The log as one block of memory, mapped where the platform supports it and read into memory elsewhere
+    struct FMappedLog
+    {
+        TUniquePtr<IMappedFileHandle> Handle;
+        TUniquePtr<IMappedFileRegion> Region;
+        TArray<uint8> Bytes;
+        const uint8* Data = nullptr;
+        int64 Size = 0;
+
+        ~FMappedLog()
+        {
+            Close();
+        }
+
+        bool Open(const FString& Path)
+        {
+            Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+            if (Handle.IsValid() && Handle->GetFileSize() > 0)
+            {
+                Region.Reset(Handle->MapRegion(0, Handle->GetFileSize()));
+                if (Region.IsValid())
+                {
+                    Data = Region->GetMappedPtr();
+                    Size = Region->GetMappedSize();
+                    return true;
+                }
+            }
+
+            if (!FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent))
+            {
+                return false;
+            }
+            Data = Bytes.GetData();
+            Size = Bytes.Num();
+            return true;
+        }
+
+        // The region has to go before the handle it was mapped from
+        void Close()
+        {
+            Region.Reset();
+            Handle.Reset();
+            Bytes.Empty();
+            Data = nullptr;
+            Size = 0;
+        }
+    };
+}
+
+FGitHubEventLog::FGitHubEventLog(const FString& InLogDirectory)
+    : LogDirectory(InLogDirectory)
+    , Queued(MakeShared<FQueuedAppends, ESPMode::ThreadSafe>())
+{
+}
+
+void FGitHubEventLog::SyncBoard(const FProjectInfo& Board, const FDateTime& Now)
+{
+    FProjectLog& Log = OpenLog(Board.ProjectId);
+    const int64 TimestampMs = ToMilliseconds(Now);
+
+    TSet<FString> ItemIds;
+    ItemIds.Reserve(Board.Items.Num());
+    int32 NumChanged = 0;
+    for (const FProjectItem& Item : Board.Items)
+    {
+        ItemIds.Add(Item.ItemId);
+        const FLoggedItem* Recorded = Log.Items.Find(Item.ItemId);
+        NumChanged += !Recorded || !IsSameItem(*Recorded, Item);
+    }
+
+    TArray<FString> RemovedItemIds;
+    for (const TPair<FString, FLoggedItem>& Logged : Log.Items)
+    {
+        if (!ItemIds.Contains(Logged.Key))
+        {
+            RemovedItemIds.Add(Logged.Key);
+        }
+    }
+
+    // All of these changes happen at the same moment, so a board that changed in bulk, like one seen for the first
+    // time, is recorded as one checkpoint of its new state instead of an event per item
+    if (NumChanged + RemovedItemIds.Num() >= EventsPerCheckpoint)
+    {
+        Log.Items.Reset();
+        Log.Items.Reserve(Board.Items.Num());
+        for (const FProjectItem& Item : Board.Items)
+        {
+            FLoggedItem& Logged = Log.Items.Add(Item.ItemId);
+            Logged.ColumnId = Item.ColumnId;
+            Logged.Title = Item.Title;
+            Logged.StartDate = Item.StartDate;
+            Logged.EndDate = Item.EndDate;
+        }
+        WriteCheckpoint(Log, TimestampMs);
+        return;
+    }
+
+    for (const FProjectItem& Item : Board.Items)
+    {
+        RecordItem(Log, Item, TimestampMs);
+    }
+    for (const FString& ItemId : RemovedItemIds)
+    {
+        RecordRemoval(Log, ItemId, TimestampMs);
+    }
+}
+
+void FGitHubEventLog::UpdateItem(const FString& ProjectId, const FProjectItem& Item, const FDateTime& Now)
+{
+    RecordItem(OpenLog(ProjectId), Item, ToMilliseconds(Now));
+}
+
+void FGitHubEventLog::RemoveItem(const FString& ProjectId, const FString& ItemId, const FDateTime& Now)
+{
+    RecordRemoval(OpenLog(ProjectId), ItemId, ToMilliseconds(Now));
+}
+
+void FGitHubEventLog::Flush()
+{
+    if (!bHasPending)
+    {
+        return;
+    }
+    bHasPending = false;
+
+    for (TPair<FString, FProjectLog>& Pair : Logs)
+    {
+        FProjectLog& Log = Pair.Value;
+        if (Log.PendingLog.Num() == 0 && Log.PendingIndex.Num() == 0)
+        {
+            continue;
+        }
+
+        Log.Size += Log.PendingLog.Num();
+        {
+            FScopeLock QueueLock(&Queued->QueueLock);
+            TPair<TArray<uint8>, TArray<uint8>>& Bytes = Queued->Bytes.FindOrAdd(Pair.Key);
+            Bytes.Key.Append(Log.PendingLog);
+            Bytes.Value.Append(Log.PendingIndex);
+        }
+        Log.PendingLog.Reset();
+        Log.PendingIndex.Reset();
+
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Queued = Queued, LogPath = GetLogPath(Pair.Key), IndexPath = GetIndexPath(Pair.Key), ProjectId = Pair.Key]()
+            {
+                GITHUB_TRACE_SCOPE(GitHub_AppendEventLog);
+                WritePending(Queued, LogPath, IndexPath, ProjectId);
+            });
+    }
+}
+
+void FGitHubEventLog::FlushAndWait()
+{
+    Flush();
+
+    // Workers that start after this find their bytes already written
+    for (const TPair<FString, FProjectLog>& Pair : Logs)
+    {
+        WritePending(Queued, GetLogPath(Pair.Key), GetIndexPath(Pair.Key), Pair.Key);
+    }
+}
+
+bool FGitHubEventLog::Reconstruct(const FString& ProjectId, const FDateTime& Time, TArray<FProjectItem>& OutItems)
+{
+    GITHUB_TRACE_SCOPE(GitHub_ReconstructBoard);
+
+    FProjectLog& Log = OpenLog(ProjectId);
+
+    // Whatever is still queued for this log is written right away, the file has to hold every event
+    Flush();
+    WritePending(Queued, GetLogPath(ProjectId), GetIndexPath(ProjectId), ProjectId);
+
+    const int64 UntilMs = ToMilliseconds(Time);
+    const int32 NextCheckpoint = Algo::UpperBoundBy(Log.Checkpoints, UntilMs, &FCheckpoint::TimestampMs);
+    if (NextCheckpoint == 0)
+    {
+        return false;
+    }
+
+    FMappedLog Mapped;
+    if (!Mapped.Open(GetLogPath(ProjectId)))
+    {
+        return false;
+    }
+
+    TMap<FString, FLoggedItem> Items;
+    Replay(Mapped.Data, Mapped.Size, Log.Checkpoints[NextCheckpoint - 1].Offset, UntilMs, Items, nullptr);
+
+    OutItems.Reset(Items.Num());
+    for (const TPair<FString, FLoggedItem>& Logged : Items)
+    {
+        FProjectItem& Item = OutItems.AddDefaulted_GetRef();
+        Item.ItemId = Logged.Key;
+        Item.ColumnId = Logged.Value.ColumnId;
+        Item.Title = Logged.Value.Title;
+        Item.StartDate = Logged.Value.StartDate;
+        Item.EndDate = Logged.Value.EndDate;
+    }
+    return true;
+}
+
+FGitHubEventLog::FProjectLog& FGitHubEventLog::OpenLog(const FString& ProjectId)
+{
+    if (FProjectLog* Existing = Logs.Find(ProjectId))
+    {
+        return *Existing;
+    }
+
+    GITHUB_TRACE_SCOPE(GitHub_OpenEventLog);
+
+    FProjectLog& Log = Logs.Add(ProjectId);
+    const FString LogPath = GetLogPath(ProjectId);
+    const FString IndexPath = GetIndexPath(ProjectId);
+
+    FMappedLog Mapped;
+    if (!Mapped.Open(LogPath))
+    {
+        // Nothing recorded yet, the first event creates the file
+        IFileManager::Get().Delete(*IndexPath, false, false, true);
+        return Log;
+    }
+
+    FRecordReader Header{ Mapped.Data, Mapped.Size };
+    const uint32 Magic = uint32(Header.ReadFixed(4));
+    const uint32 Version = uint32(Header.ReadFixed(4));
+    if (Header.bError || Magic != LogMagic || Version != LogVersion)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Event log of project %s has an unknown format, the history starts over."), *ProjectId);
+        Mapped.Close();
+        IFileManager::Get().Delete(*LogPath, false, false, true);
+        IFileManager::Get().Delete(*IndexPath, false, false, true);
+        return Log;
+    }
+
+    TArray<uint8> IndexBytes;
+    FFileHelper::LoadFileToArray(IndexBytes, *IndexPath, FILEREAD_Silent);
+    FRecordReader IndexReader{ IndexBytes.GetData(), IndexBytes.Num() };
+    while (IndexReader.Offset + 16 <= IndexReader.Size)
+    {
+        FCheckpoint& Checkpoint = Log.Checkpoints.AddDefaulted_GetRef();
+        Checkpoint.TimestampMs = int64(IndexReader.ReadFixed(8));
+        Checkpoint.Offset = int64(IndexReader.ReadFixed(8));
+    }
+
+    // Checkpoints past the end of the log belong to events a crash kept from being written
+    bool bIndexChanged = IndexReader.Offset != IndexReader.Size;
+    while (Log.Checkpoints.Num() > 0 && Log.Checkpoints.Last().Offset >= Mapped.Size)
+    {
+        Log.Checkpoints.Pop();
+        bIndexChanged = true;
+    }
+
+    // The current state is the last checkpoint plus the events after it, checkpoints missing from the index are found on the way
+    TArray<FCheckpoint> Found;
+    int64 End = HeaderSize;
+    while (true)
+    {
+        const int64 Start = Log.Checkpoints.Num() > 0 ? Log.Checkpoints.Last().Offset : HeaderSize;
+        Found.Reset();
+        Log.Items.Reset();
+        End = Replay(Mapped.Data, Mapped.Size, Start, MAX_int64, Log.Items, &Found);
+        if (End > Start || Log.Checkpoints.Num() == 0)
+        {
+            break;
+        }
+
+        // The last indexed checkpoint was cut off itself, the one before it is complete
+        Log.Checkpoints.Pop();
+        bIndexChanged = true;
+    }
+
+    for (const FCheckpoint& Checkpoint : Found)
+    {
+        if (Log.Checkpoints.Num() == 0 || Checkpoint.Offset > Log.Checkpoints.Last().Offset)
+        {
+            Log.Checkpoints.Add(Checkpoint);
+            bIndexChanged = true;
+        }
+    }
+
+    const int64 FileSize = Mapped.Size;
+    Mapped.Close();
+    Log.Size = End;
+
+    // An event cut off by a crash would make everything appended after it unreadable
+    if (End < FileSize)
+    {
+        TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*LogPath, true, true));
+        if (!Handle.IsValid() || !Handle->Truncate(End))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Event log of project %s could not be repaired, the history starts over."), *ProjectId);
+            Handle.Reset();
+            IFileManager::Get().Delete(*LogPath, false, false, true);
+            IFileManager::Get().Delete(*IndexPath, false, false, true);
+            Log = FProjectLog();
+            return Log;
+        }
+        UE_LOG(LogTemp, Warning, TEXT("Event log of project %s ended in an incomplete event, %lld bytes were cut off."), *ProjectId, FileSize - End);
+    }
+
+    if (bIndexChanged)
+    {
+        TArray<uint8> Rewritten;
+        for (const FCheckpoint& Checkpoint : Log.Checkpoints)
+        {
+            WriteFixed(Rewritten, uint64(Checkpoint.TimestampMs), 8);
+            WriteFixed(Rewritten, uint64(Checkpoint.Offset), 8);
+        }
+        FFileHelper::SaveArrayToFile(Rewritten, *IndexPath);
+    }
+    return Log;
+}
+
+void FGitHubEventLog::RecordItem(FProjectLog& Log, const FProjectItem& Item, int64 TimestampMs)
+{
+    // Every event updates the recorded state right away, so a checkpoint written before the next one is exact
+    FLoggedItem* Recorded = Log.Items.Find(Item.ItemId);
+    if (!Recorded)
+    {
+        BeginEvent(Log, uint8(EEventKind::Created), TimestampMs);
+        WriteString(Log, Item.ItemId);
+        WriteString(Log, Item.ColumnId);
+        WriteString(Log, Item.Title);
+        WriteString(Log, Item.StartDate);
+        WriteString(Log, Item.EndDate);
+        EndEvent(Log);
+
+        FLoggedItem& Created = Log.Items.Add(Item.ItemId);
+        Created.ColumnId = Item.ColumnId;
+        Created.Title = Item.Title;
+        Created.StartDate = Item.StartDate;
+        Created.EndDate = Item.EndDate;
+        return;
+    }
+
+    if (!IsSameString(Recorded->ColumnId, Item.ColumnId))
+    {
+        BeginEvent(Log, uint8(EEventKind::Moved), TimestampMs);
+        WriteString(Log, Item.ItemId);
+        WriteString(Log, Item.ColumnId);
+        EndEvent(Log);
+        Recorded->ColumnId = Item.ColumnId;
+    }
+
+    if (!IsSameString(Recorded->StartDate, Item.StartDate) || !IsSameString(Recorded->EndDate, Item.EndDate))
+    {
+        BeginEvent(Log, uint8(EEventKind::DatesChanged), TimestampMs);
+        WriteString(Log, Item.ItemId);
+        WriteString(Log, Item.StartDate);
+        WriteString(Log, Item.EndDate);
+        EndEvent(Log);
+        Recorded->StartDate = Item.StartDate;
+        Recorded->EndDate = Item.EndDate;
+    }
+
+    if (!IsSameString(Recorded->Title, Item.Title))
+    {
+        BeginEvent(Log, uint8(EEventKind::TitleChanged), TimestampMs);
+        WriteString(Log, Item.ItemId);
+        WriteString(Log, Item.Title);
+        EndEvent(Log);
+        Recorded->Title = Item.Title;
+    }
+}
+
+bool FGitHubEventLog::IsSameItem(const FLoggedItem& Logged, const FProjectItem& Item)
+{
+    return IsSameString(Logged.ColumnId, Item.ColumnId) && IsSameString(Logged.Title, Item.Title)
+        && IsSameString(Logged.StartDate, Item.StartDate) && IsSameString(Logged.EndDate, Item.EndDate);
+}
+
+bool FGitHubEventLog::IsSameString(const FString& A, const FString& B)
+{
+    // FString compares ignoring case by default, a title changed only in case is still a change
+    return A.Equals(B, ESearchCase::CaseSensitive);
+}
+
+void FGitHubEventLog::RecordRemoval(FProjectLog& Log, const FString& ItemId, int64 TimestampMs)
+{
+    if (!Log.Items.Contains(ItemId))
+    {
+        return;
+    }
+
+    BeginEvent(Log, uint8(EEventKind::Removed), TimestampMs);
+    WriteString(Log, ItemId);
+    EndEvent(Log);
+    Log.Items.Remove(ItemId);
+}
+
+void FGitHubEventLog::BeginEvent(FProjectLog& Log, uint8 Kind, int64 TimestampMs)
+{
+    if (!Log.bSegmentOpen)
+    {
+        WriteCheckpoint(Log, TimestampMs);
+    }
+
+    // A clock set back must not make the deltas negative
+    Log.PendingLog.Add(Kind);
+    WriteVarint(Log.PendingLog, uint64(FMath::Max<int64>(0, TimestampMs - Log.LastTimestampMs)));
+    Log.LastTimestampMs = FMath::Max(Log.LastTimestampMs, TimestampMs);
+    bHasPending = true;
+}
+
+void FGitHubEventLog::EndEvent(FProjectLog& Log)
+{
+    // The next event then starts a new segment with a checkpoint of the state up to here
+    const int64 SegmentBytes = Log.Size + Log.PendingLog.Num() - Log.SegmentEventsOffset;
+    if (++Log.EventsSinceCheckpoint >= EventsPerCheckpoint && SegmentBytes >= Log.CheckpointBytes)
+    {
+        Log.bSegmentOpen = false;
+    }
+}
+
+void FGitHubEventLog::WriteCheckpoint(FProjectLog& Log, int64 TimestampMs)
+{
+    if (Log.Size == 0 && Log.PendingLog.Num() == 0)
+    {
+        WriteFixed(Log.PendingLog, LogMagic, 4);
+        WriteFixed(Log.PendingLog, LogVersion, 4);
+    }
+
+    // Checkpoints are never earlier than the events before them, the index stays sorted
+    TimestampMs = FMath::Max(TimestampMs, Log.Checkpoints.Num() > 0 ? Log.Checkpoints.Last().TimestampMs : TimestampMs);
+    FCheckpoint& Checkpoint = Log.Checkpoints.AddDefaulted_GetRef();
+    Checkpoint.TimestampMs = TimestampMs;
+    Checkpoint.Offset = Log.Size + Log.PendingLog.Num();
+    WriteFixed(Log.PendingIndex, uint64(Checkpoint.TimestampMs), 8);
+    WriteFixed(Log.PendingIndex, uint64(Checkpoint.Offset), 8);
+
+    Log.StringTable.Reset();
+    Log.PendingLog.Add(uint8(EEventKind::Checkpoint));
+    WriteFixed(Log.PendingLog, uint64(TimestampMs), 8);
+    WriteVarint(Log.PendingLog, Log.Items.Num());
+    for (const TPair<FString, FLoggedItem>& Logged : Log.Items)
+    {
+        WriteString(Log, Logged.Key);
+        WriteString(Log, Logged.Value.ColumnId);
+        WriteString(Log, Logged.Value.Title);
+        WriteString(Log, Logged.Value.StartDate);
+        WriteString(Log, Logged.Value.EndDate);
+    }
+
+    Log.SegmentEventsOffset = Log.Size + Log.PendingLog.Num();
+    Log.CheckpointBytes = Log.SegmentEventsOffset - Checkpoint.Offset;
+    Log.LastTimestampMs = TimestampMs;
+    Log.EventsSinceCheckpoint = 0;
+    Log.bSegmentOpen = true;
+    bHasPending = true;
+}
+
+void FGitHubEventLog::WriteString(FProjectLog& Log, const FString& Text)
+{
+    if (const int32* Index = Log.StringTable.Find(Text))
+    {
+        WriteVarint(Log.PendingLog, uint64(*Index) << 1);
+        return;
+    }
+
+    Log.StringTable.Add(Text, Log.StringTable.Num());
+    const FTCHARToUTF8 Converted(*Text, Text.Len());
+    WriteVarint(Log.PendingLog, (uint64(Converted.Length()) << 1) | 1);
+    Log.PendingLog.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+}
+
+int64 FGitHubEventLog::Replay(const uint8* Data, int64 Size, int64 Offset, int64 UntilMs, TMap<FString, FLoggedItem>& Items, TArray<FCheckpoint>* OutCheckpoints)
+{
+    FRecordReader Reader{ Data, Size, Offset };
+    TArray<FString> Strings;
+    int64 TimestampMs = 0;
+    int64 End = Offset;
+    bool bInSegment = false;
+
+    while (Reader.Offset < Size)
+    {
+        const int64 RecordStart = Reader.Offset;
+        const EEventKind Kind = EEventKind(Reader.ReadFixed(1));
+
+        if (Kind == EEventKind::Checkpoint)
+        {
+            const int64 CheckpointMs = int64(Reader.ReadFixed(8));
+            const uint64 Count = Reader.ReadVarint();
+            if (Reader.bError || CheckpointMs > UntilMs || Count > uint64(Size - Reader.Offset))
+            {
+                break;
+            }
+
+            Strings.Reset();
+            TMap<FString, FLoggedItem> Snapshot;
+            Snapshot.Reserve(int32(Count));
+            for (uint64 Index = 0; Index < Count && !Reader.bError; ++Index)
+            {
+                const FString ItemId = Reader.ReadString(Strings);
+                FLoggedItem& Item = Snapshot.Add(ItemId);
+                Item.ColumnId = Reader.ReadString(Strings);
+                Item.Title = Reader.ReadString(Strings);
+                Item.StartDate = Reader.ReadString(Strings);
+                Item.EndDate = Reader.ReadString(Strings);
+            }
+            if (Reader.bError)
+            {
+                break;
+            }
+
+            Items = MoveTemp(Snapshot);
+            TimestampMs = CheckpointMs;
+            bInSegment = true;
+            if (OutCheckpoints)
+            {
+                FCheckpoint& Checkpoint = OutCheckpoints->AddDefaulted_GetRef();
+                Checkpoint.TimestampMs = CheckpointMs;
+                Checkpoint.Offset = RecordStart;
+            }
+        }
+        else
+        {
+            // Events only make sense on top of the checkpoint of their segment
+            if (!bInSegment)
+            {
+                break;
+            }
+
+            const int64 EventMs = TimestampMs + int64(Reader.ReadVarint());
+            if (Reader.bError || EventMs > UntilMs)
+            {
+                break;
+            }
+
+            // All fields are read before anything is applied, a cut off event leaves the state as it was
+            const FString ItemId = Reader.ReadString(Strings);
+            FLoggedItem Fields;
+            switch (Kind)
+            {
+            case EEventKind::Created:
+                Fields.ColumnId = Reader.ReadString(Strings);
+                Fields.Title = Reader.ReadString(Strings);
+                Fields.StartDate = Reader.ReadString(Strings);
+                Fields.EndDate = Reader.ReadString(Strings);
+                break;
+            case EEventKind::Moved:
+                Fields.ColumnId = Reader.ReadString(Strings);
+                break;
+            case EEventKind::DatesChanged:
+                Fields.StartDate = Reader.ReadString(Strings);
+                Fields.EndDate = Reader.ReadString(Strings);
+                break;
+            case EEventKind::TitleChanged:
+                Fields.Title = Reader.ReadString(Strings);
+                break;
+            case EEventKind::Removed:
+                break;
+            default:
+                Reader.bError = true;
+                break;
+            }
+            if (Reader.bError)
+            {
+                break;
+            }
+
+            switch (Kind)
+            {
+            case EEventKind::Created:
+                Items.Add(ItemId, MoveTemp(Fields));
+                break;
+            case EEventKind::Moved:
+                Items.FindOrAdd(ItemId).ColumnId = MoveTemp(Fields.ColumnId);
+                break;
+            case EEventKind::DatesChanged:
+            {
+                FLoggedItem& Item = Items.FindOrAdd(ItemId);
+                Item.StartDate = MoveTemp(Fields.StartDate);
+                Item.EndDate = MoveTemp(Fields.EndDate);
+                break;
+            }
+            case EEventKind::TitleChanged:
+                Items.FindOrAdd(ItemId).Title = MoveTemp(Fields.Title);
+                break;
+            default:
+                Items.Remove(ItemId);
+                break;
+            }
+            TimestampMs = EventMs;
+        }
+
+        End = Reader.Offset;
+    }
+    return End;
+}
+
+void FGitHubEventLog::WritePending(const TSharedRef<FQueuedAppends, ESPMode::ThreadSafe>& Queued, const FString& LogPath, const FString& IndexPath, const FString& ProjectId)
+{
+    // Held for the whole append, whichever writer comes first takes all queued bytes and the order is kept
+    FScopeLock FileLock(&Queued->FileLock);
+
+    TPair<TArray<uint8>, TArray<uint8>> Bytes;
+    {
+        FScopeLock QueueLock(&Queued->QueueLock);
+        if (!Queued->Bytes.RemoveAndCopyValue(ProjectId, Bytes))
+        {
+            return;
+        }
+    }
+
+    // The log goes first, an index entry never points past what was written
+    const bool bWritten = (Bytes.Key.Num() == 0 || FFileHelper::SaveArrayToFile(Bytes.Key, *LogPath, &IFileManager::Get(), FILEWRITE_Append))
+        && (Bytes.Value.Num() == 0 || FFileHelper::SaveArrayToFile(Bytes.Value, *IndexPath, &IFileManager::Get(), FILEWRITE_Append));
+    if (!bWritten)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Events of project %s could not be appended to %s."), *ProjectId, *LogPath);
+    }
+}
+
+FString FGitHubEventLog::GetLogPath(const FString& ProjectId) const
+{
+    return LogDirectory / FPaths::MakeValidFileName(ProjectId) + TEXT(".ghlog");
+}
+
+FString FGitHubEventLog::GetIndexPath(const FString& ProjectId) const
+{
+    return LogDirectory / FPaths::MakeValidFileName(ProjectId) + TEXT(".ghidx");
+}
@@ -0,0 +1,121 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+struct FProjectItem;
+struct FProjectInfo;
+
+/**
+ * Append-only history of the item changes seen on each project board, one binary file per project.
+ *
+ * Every change that differs from the last recorded state of an item is appended as an event: created, moved
+ * to another ColumnId, dates changed, title changed or removed. Events carry a variable length time delta in
+ * milliseconds and their strings are interned, so a move costs a few bytes. The file is made of segments that
+ * each start with a checkpoint of the whole board, which resets the delta base and the string table. A board
+ * that changes in bulk, like one seen for the first time, is recorded as a checkpoint right away. A small
+ * sidecar file lists the timestamp and offset of every checkpoint, so the state at a past time is the closest
+ * earlier checkpoint plus at most one segment of events, read from a memory mapped view.
+ *
+ * Events are encoded on the game thread and appended by a background worker on Flush. Game thread only.
+ */
+class FGitHubEventLog
+{
+public:
+	explicit FGitHubEventLog(const FString& InLogDirectory);
+
+	// Takes the board as it is, logging an event for every item that differs from its recorded state
+	void SyncBoard(const FProjectInfo& Board, const FDateTime& Now);
+
+	// Item created, moved or edited at Now
+	void UpdateItem(const FString& ProjectId, const FProjectItem& Item, const FDateTime& Now);
+	void RemoveItem(const FString& ProjectId, const FString& ItemId, const FDateTime& Now);
+
+	// Hands the events encoded since the last call to a background worker
+	void Flush();
+	bool HasPendingEvents() const { return bHasPending; }
+
+	// Writes every event recorded so far before returning, including appends still queued for a worker
+	void FlushAndWait();
+
+	// Items as recorded at Time with their ColumnId, Title, StartDate and EndDate, false if nothing was recorded before Time
+	bool Reconstruct(const FString& ProjectId, const FDateTime& Time, TArray<FProjectItem>& OutItems);
+
+private:
+	struct FLoggedItem
+	{
+		FString ColumnId;
+		FString Title;
+		FString StartDate;
+		FString EndDate;
+	};
+
+	// Interned strings are matched exactly, the default FString key funcs ignore case
+	struct FCaseSensitiveKeyFuncs : BaseKeyFuncs<TPair<FString, int32>, FString, false>
+	{
+		static const FString& GetSetKey(const TPair<FString, int32>& Element) { return Element.Key; }
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	struct FCheckpoint
+	{
+		int64 TimestampMs = 0;
+		int64 Offset = 0;
+	};
+
+	struct FProjectLog
+	{
+		TMap<FString, FLoggedItem> Items;
+		TArray<FCheckpoint> Checkpoints;
+
+		// Strings of the current segment by their index
+		TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> StringTable;
+
+		// Size of the file once the bytes handed to the workers are written
+		int64 Size = 0;
+		int64 LastTimestampMs = 0;
+		int32 EventsSinceCheckpoint = 0;
+
+		// Where the events of the current segment start and how large its checkpoint is
+		int64 SegmentEventsOffset = 0;
+		int64 CheckpointBytes = 0;
+		bool bSegmentOpen = false;
+
+		// Encoded but not handed to a worker yet
+		TArray<uint8> PendingLog;
+		TArray<uint8> PendingIndex;
+	};
+
+	// Bytes handed to the workers, shared with them. FileLock keeps the appends of one log in order.
+	struct FQueuedAppends
+	{
+		FCriticalSection FileLock;
+		FCriticalSection QueueLock;
+		TMap<FString, TPair<TArray<uint8>, TArray<uint8>>> Bytes;
+	};
+
+	FProjectLog& OpenLog(const FString& ProjectId);
+	void RecordItem(FProjectLog& Log, const FProjectItem& Item, int64 TimestampMs);
+	void RecordRemoval(FProjectLog& Log, const FString& ItemId, int64 TimestampMs);
+	static bool IsSameItem(const FLoggedItem& Logged, const FProjectItem& Item);
+	static bool IsSameString(const FString& A, const FString& B);
+	void BeginEvent(FProjectLog& Log, uint8 Kind, int64 TimestampMs);
+	void EndEvent(FProjectLog& Log);
+	void WriteCheckpoint(FProjectLog& Log, int64 TimestampMs);
+	void WriteString(FProjectLog& Log, const FString& Text);
+
+	// Replays the records from Offset into Items until one is later than UntilMs, returns where the last complete record ends
+	static int64 Replay(const uint8* Data, int64 Size, int64 Offset, int64 UntilMs, TMap<FString, FLoggedItem>& Items, TArray<FCheckpoint>* OutCheckpoints);
+	static void WritePending(const TSharedRef<FQueuedAppends, ESPMode::ThreadSafe>& Queued, const FString& LogPath, const FString& IndexPath, const FString& ProjectId);
+
+	FString GetLogPath(const FString& ProjectId) const;
+	FString GetIndexPath(const FString& ProjectId) const;
+
+	FString LogDirectory;
+	TMap<FString, FProjectLog> Logs;
+	TSharedRef<FQueuedAppends, ESPMode::ThreadSafe> Queued;
+	bool bHasPending = false;
+};
@@ -0,0 +1,191 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubItemDelivery.h"
+#include "Algo/Sort.h"
+
+namespace
+{
+    // Small enough that a listener building one widget per item stays well inside a frame
+    constexpr int32 ItemsPerChunk = 32;
+}
+
+bool FGitHubItemDelivery::FFocus::Contains(const FProjectItem& Item) const
+{
+    if (ColumnIds.Contains(Item.ColumnId))
+    {
+        return true;
+    }
+
+    // Items without dates are never inside a date range
+    return RangeEnd > RangeStart && Item.StartDateTime.GetTicks() > 0 && Item.EndDateTime.GetTicks() > 0
+        && Item.StartDateTime <= RangeEnd && Item.EndDateTime >= RangeStart;
+}
+
+void FGitHubItemDelivery::Start(const FProjectInfo& Board)
+{
+    FPending& Pending = Deliveries.Add(Board.ProjectId);
+    Pending.Generation = ++LastGeneration;
+    Pending.ItemIds.Reserve(Board.Items.Num());
+    for (const FProjectItem& Item : Board.Items)
+    {
+        Pending.ItemIds.Add(Item.ItemId);
+    }
+    Pending.Remaining.Append(Pending.ItemIds);
+
+    OrderByFocus(Pending.ItemIds, Board, FocusByProject.Find(Board.ProjectId));
+}
+
+void FGitHubItemDelivery::Cancel(const FString& ProjectId)
+{
+    Deliveries.Remove(ProjectId);
+}
+
+void FGitHubItemDelivery::SetFocus(const FString& ProjectId, const FFocus& Focus, const FProjectInfo* Board)
+{
+    if (Focus.IsEmpty())
+    {
+        FocusByProject.Remove(ProjectId);
+        return;
+    }
+
+    FocusByProject.Add(ProjectId, Focus);
+
+    FPending* Pending = Deliveries.Find(ProjectId);
+    if (Pending && Board)
+    {
+        OrderByFocus(Pending->ItemIds, *Board, &Focus);
+    }
+}
+
+bool FGitHubItemDelivery::IsPending(const FString& ProjectId, const FString& ItemId) const
+{
+    const FPending* Pending = Deliveries.Find(ProjectId);
+    return Pending && Pending->Remaining.Contains(ItemId);
+}
+
+void FGitHubItemDelivery::Tick(double BudgetSeconds,
+    TFunctionRef<TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>(const FString&)> FindBoard,
+    TFunctionRef<void(const FString&, const TArray<FProjectItem>&)> Deliver,
+    TFunctionRef<void(const FString&, int32)> Complete)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    bool bDeliveredAny = false;
+
+    TArray<FString> ProjectIds;
+    Deliveries.GetKeys(ProjectIds);
+    for (const FString& ProjectId : ProjectIds)
+    {
+        TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Board = FindBoard(ProjectId);
+        if (!Board.IsValid())
+        {
+            Deliveries.Remove(ProjectId);
+            continue;
+        }
+
+        FPending* Pending = Deliveries.Find(ProjectId);
+        bool bIndexRebuilt = false;
+        if (Pending->IndexedBoard.Pin() != Board)
+        {
+            RebuildIndex(*Pending, Board);
+            bIndexRebuilt = true;
+        }
+
+        // Listeners may restart or cancel the delivery from their handler, so the entry is looked up again after each chunk
+        const uint32 Generation = Pending->Generation;
+        while (Pending && Pending->Generation == Generation && Pending->ItemIds.Num() > 0 && (!bDeliveredAny || FPlatformTime::Seconds() - StartTime < BudgetSeconds))
+        {
+            TArray<FProjectItem> Chunk;
+            Chunk.Reserve(ItemsPerChunk);
+            while (Pending->ItemIds.Num() > 0 && Chunk.Num() < ItemsPerChunk)
+            {
+                const FString ItemId = Pending->ItemIds.Pop(EAllowShrinking::No);
+                Pending->Remaining.Remove(ItemId);
+                if (const FProjectItem* Item = FindItem(*Pending, Board, ItemId, bIndexRebuilt))
+                {
+                    Chunk.Add(*Item);
+                }
+            }
+
+            Pending->Delivered += Chunk.Num();
+            if (Chunk.Num() > 0)
+            {
+                Deliver(ProjectId, Chunk);
+                bDeliveredAny = true;
+            }
+            Pending = Deliveries.Find(ProjectId);
+        }
+
+        if (Pending && Pending->Generation == Generation && Pending->ItemIds.Num() == 0)
+        {
+            const int32 Delivered = Pending->Delivered;
+            Deliveries.Remove(ProjectId);
+            Complete(ProjectId, Delivered);
+        }
+
+        if (bDeliveredAny && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            return;
+        }
+    }
+}
+
+const FProjectItem* FGitHubItemDelivery::FindItem(FPending& Pending, const TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>& Board, const FString& ItemId, bool& bIndexRebuilt)
+{
+    // A board held only by the manager is edited in place, so a position is only trusted once it still holds the item
+    const int32* Index = Pending.IndexById.Find(ItemId);
+    if (Index && Board->Items.IsValidIndex(*Index) && Board->Items[*Index].ItemId == ItemId)
+    {
+        return &Board->Items[*Index];
+    }
+
+    // The board is not edited during a tick, once rebuilt a miss means the item was deleted
+    if (bIndexRebuilt)
+    {
+        return nullptr;
+    }
+
+    RebuildIndex(Pending, Board);
+    bIndexRebuilt = true;
+    Index = Pending.IndexById.Find(ItemId);
+    return Index ? &Board->Items[*Index] : nullptr;
+}
+
+void FGitHubItemDelivery::RebuildIndex(FPending& Pending, const TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>& Board)
+{
+    Pending.IndexedBoard = Board;
+    Pending.IndexById.Reset();
+    for (int32 Index = 0; Index < Board->Items.Num(); ++Index)
+    {
+        Pending.IndexById.Add(Board->Items[Index].ItemId, Index);
+    }
+}
+
+void FGitHubItemDelivery::OrderByFocus(TArray<FString>& ItemIds, const FProjectInfo& Board, const FFocus* Focus)
+{
+    // ItemIds is consumed from the back, so it holds board order reversed with the focused items at the end
+    TSet<FString> Focused;
+    if (Focus)
+    {
+        for (const FProjectItem& Item : Board.Items)
+        {
+            if (Focus->Contains(Item))
+            {
+                Focused.Add(Item.ItemId);
+            }
+        }
+    }
+
+    TMap<FString, int32> BoardOrder;
+    BoardOrder.Reserve(Board.Items.Num());
+    for (int32 Index = 0; Index < Board.Items.Num(); ++Index)
+    {
+        BoardOrder.Add(Board.Items[Index].ItemId, Index);
+    }
+
+    Algo::SortBy(ItemIds, [&Focused, &BoardOrder](const FString& ItemId)
+        {
+            const int32* Index = BoardOrder.Find(ItemId);
+            return (Focused.Contains(ItemId) ? (int64(1) << 32) : 0) - (Index ? *Index : 0);
+        });
+}
@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UGitHubAPIManager.h"
+
+/**
+ * Hands the items of freshly loaded boards to listeners a chunk at a time, within a per-frame time budget.
+ *
+ * Items on screen go first: those in a visible column or overlapping the visible date range. Items are
+ * looked up in the current board each frame, so edits made while a board is still being delivered are
+ * sent in their latest state and deleted items are skipped. Game thread only.
+ */
+class FGitHubItemDelivery
+{
+public:
+	struct FFocus
+	{
+		TSet<FString> ColumnIds;
+		FDateTime RangeStart;
+		FDateTime RangeEnd;
+
+		bool IsEmpty() const { return ColumnIds.Num() == 0 && RangeEnd <= RangeStart; }
+		bool Contains(const FProjectItem& Item) const;
+	};
+
+	// Queues every item of Board, replacing a delivery of the same project that is still running
+	void Start(const FProjectInfo& Board);
+	void Cancel(const FString& ProjectId);
+
+	// Stores what is visible of a project and moves those items of a running delivery to the front
+	void SetFocus(const FString& ProjectId, const FFocus& Focus, const FProjectInfo* Board);
+	FFocus GetFocus(const FString& ProjectId) const { return FocusByProject.FindRef(ProjectId); }
+
+	bool IsActive(const FString& ProjectId) const { return Deliveries.Contains(ProjectId); }
+	bool IsPending(const FString& ProjectId, const FString& ItemId) const;
+	bool IsEmpty() const { return Deliveries.Num() == 0; }
+
+	// Delivers chunks until BudgetSeconds are spent, always at least one so every board makes progress.
+	// Deliver receives the chunks, Complete the project and item count once a board is through.
+	void Tick(double BudgetSeconds,
+		TFunctionRef<TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>(const FString&)> FindBoard,
+		TFunctionRef<void(const FString&, const TArray<FProjectItem>&)> Deliver,
+		TFunctionRef<void(const FString&, int32)> Complete);
+
+private:
+	struct FPending
+	{
+		// Still to deliver, next one last so taking a chunk is a pop
+		TArray<FString> ItemIds;
+		TSet<FString> Remaining;
+		int32 Delivered = 0;
+		uint32 Generation = 0;
+
+		// Item positions in the board they were looked up in, rebuilt once the board is replaced or edited in place
+		TWeakPtr<FProjectInfo, ESPMode::ThreadSafe> IndexedBoard;
+		TMap<FString, int32> IndexById;
+	};
+
+	// Rebuilds the index at most once per tick, bIndexRebuilt tells whether that already happened
+	static const FProjectItem* FindItem(FPending& Pending, const TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>& Board, const FString& ItemId, bool& bIndexRebuilt);
+	static void RebuildIndex(FPending& Pending, const TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>& Board);
+	static void OrderByFocus(TArray<FString>& ItemIds, const FProjectInfo& Board, const FFocus* Focus);
+
+	TMap<FString, FPending> Deliveries;
+	TMap<FString, FFocus> FocusByProject;
+	uint32 LastGeneration = 0;
+};
@@ -0,0 +1,292 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubMutationQueue.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+    constexpr int32 JournalVersion = 1;
+
+    const TCHAR* KindToString(EGitHubFieldValueKind Kind)
+    {
+        return Kind == EGitHubFieldValueKind::SingleSelectOption ? TEXT("singleSelectOptionId") : TEXT("date");
+    }
+}
+
+FGitHubMutationQueue::FGitHubMutationQueue(const FString& InJournalPath)
+    : JournalPath(InJournalPath)
+{
+}
+
+void FGitHubMutationQueue::Load()
+{
+    Entries.Reset();
+    Staged.Reset();
+    InFlightCount = 0;
+    bStagedUnsaved = false;
+
+    FString JournalText;
+    if (!FFileHelper::LoadFileToString(JournalText, *JournalPath))
+    {
+        return;
+    }
+
+    TSharedPtr<FJsonObject> JournalObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JournalText);
+    const TArray<TSharedPtr<FJsonValue>>* MutationValues;
+    if (!FJsonSerializer::Deserialize(Reader, JournalObject) || !JournalObject.IsValid() || !JournalObject->TryGetArrayField(TEXT("mutations"), MutationValues))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Mutation journal %s could not be read, pending edits are lost."), *JournalPath);
+        return;
+    }
+
+    for (const TSharedPtr<FJsonValue>& Value : *MutationValues)
+    {
+        const TSharedPtr<FJsonObject>* MutationObject;
+        if (!Value->TryGetObject(MutationObject))
+        {
+            continue;
+        }
+
+        FGitHubQueuedMutation Mutation;
+        FString Kind;
+        if ((*MutationObject)->TryGetStringField(TEXT("projectId"), Mutation.ProjectId)
+            && (*MutationObject)->TryGetStringField(TEXT("itemId"), Mutation.ItemId)
+            && (*MutationObject)->TryGetStringField(TEXT("fieldId"), Mutation.FieldId)
+            && (*MutationObject)->TryGetStringField(TEXT("kind"), Kind)
+            && (*MutationObject)->TryGetStringField(TEXT("value"), Mutation.Value))
+        {
+            Mutation.Kind = Kind == TEXT("singleSelectOptionId") ? EGitHubFieldValueKind::SingleSelectOption : EGitHubFieldValueKind::Date;
+            Entries.Add(MoveTemp(Mutation));
+        }
+    }
+
+    if (Entries.Num() > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("%d pending GitHub edits restored from the mutation journal."), Entries.Num());
+    }
+}
+
+bool FGitHubMutationQueue::Enqueue(const FGitHubQueuedMutation& Mutation)
+{
+    const bool bReplaced = RemoveUnsent(Mutation);
+    Entries.Add(Mutation);
+    Save();
+    return bReplaced;
+}
+
+bool FGitHubMutationQueue::RemoveUnsent(const FGitHubQueuedMutation& Mutation)
+{
+    // The in-flight batch has already left, a newer value has to be sent after it
+    for (int32 Index = InFlightCount; Index < Entries.Num(); ++Index)
+    {
+        if (Entries[Index].ItemId == Mutation.ItemId && Entries[Index].FieldId == Mutation.FieldId)
+        {
+            Entries.RemoveAt(Index);
+            return true;
+        }
+    }
+    return false;
+}
+
+void FGitHubMutationQueue::Stage(const FGitHubQueuedMutation& Mutation, double ReadyTime)
+{
+    FStagedMutation* Existing = Staged.FindByPredicate([&Mutation](const FStagedMutation& Candidate)
+        {
+            return Candidate.Mutation.ItemId == Mutation.ItemId && Candidate.Mutation.FieldId == Mutation.FieldId;
+        });
+
+    if (Existing)
+    {
+        Existing->Mutation = Mutation;
+        Existing->ReadyTime = ReadyTime;
+    }
+    else
+    {
+        Staged.Add({ Mutation, ReadyTime });
+    }
+
+    bStagedUnsaved = true;
+}
+
+double FGitHubMutationQueue::EnqueueStaged(double Now)
+{
+    double NextReadyTime = 0.0;
+    bool bEnqueued = false;
+    for (int32 Index = 0; Index < Staged.Num();)
+    {
+        if (Staged[Index].ReadyTime > Now)
+        {
+            NextReadyTime = NextReadyTime > 0.0 ? FMath::Min(NextReadyTime, Staged[Index].ReadyTime) : Staged[Index].ReadyTime;
+            ++Index;
+            continue;
+        }
+
+        RemoveUnsent(Staged[Index].Mutation);
+        Entries.Add(Staged[Index].Mutation);
+        Staged.RemoveAt(Index);
+        bEnqueued = true;
+    }
+
+    // One journal write for everything that settled in this pass
+    if (bEnqueued)
+    {
+        Save();
+    }
+    return NextReadyTime;
+}
+
+void FGitHubMutationQueue::SaveStaged()
+{
+    if (bStagedUnsaved)
+    {
+        Save();
+    }
+}
+
+bool FGitHubMutationQueue::BeginNext(TArray<FGitHubQueuedMutation>& OutBatch, int32 MaxBatchSize)
+{
+    if (InFlightCount > 0 || Entries.Num() == 0)
+    {
+        return false;
+    }
+
+    // Pull later edits of the head's item up behind it. Edits of other items are independent, so only
+    // their relative order to each other has to be kept.
+    const FString ItemId = Entries[0].ItemId;
+    InFlightCount = 1;
+    for (int32 Index = 1; Index < Entries.Num() && InFlightCount < MaxBatchSize; ++Index)
+    {
+        if (Entries[Index].ItemId == ItemId)
+        {
+            FGitHubQueuedMutation Mutation = MoveTemp(Entries[Index]);
+            Entries.RemoveAt(Index);
+            Entries.Insert(MoveTemp(Mutation), InFlightCount++);
+        }
+    }
+
+    OutBatch.Reset();
+    OutBatch.Append(Entries.GetData(), InFlightCount);
+    return true;
+}
+
+void FGitHubMutationQueue::CompleteInFlight()
+{
+    if (InFlightCount > 0)
+    {
+        Entries.RemoveAt(0, InFlightCount);
+        InFlightCount = 0;
+        Save();
+    }
+}
+
+void FGitHubMutationQueue::AbortInFlight()
+{
+    InFlightCount = 0;
+}
+
+bool FGitHubMutationQueue::Withdraw(const FString& ItemId, const FString& FieldId)
+{
+    const int32 RemovedStaged = Staged.RemoveAll([&ItemId, &FieldId](const FStagedMutation& Candidate)
+        {
+            return Candidate.Mutation.ItemId == ItemId && Candidate.Mutation.FieldId == FieldId;
+        });
+
+    FGitHubQueuedMutation Key;
+    Key.ItemId = ItemId;
+    Key.FieldId = FieldId;
+    const bool bRemovedEntry = RemoveUnsent(Key);
+    if (bRemovedEntry)
+    {
+        Save();
+    }
+    else if (RemovedStaged > 0)
+    {
+        bStagedUnsaved = true;
+    }
+
+    return RemovedStaged > 0 || bRemovedEntry;
+}
+
+bool FGitHubMutationQueue::HasPending(const FString& ItemId, const FString& FieldId) const
+{
+    for (int32 Index = InFlightCount; Index < Entries.Num(); ++Index)
+    {
+        if (Entries[Index].ItemId == ItemId && Entries[Index].FieldId == FieldId)
+        {
+            return true;
+        }
+    }
+
+    return Staged.ContainsByPredicate([&ItemId, &FieldId](const FStagedMutation& Candidate)
+        {
+            return Candidate.Mutation.ItemId == ItemId && Candidate.Mutation.FieldId == FieldId;
+        });
+}
+
+bool FGitHubMutationQueue::HasUnsettled(const FString& ItemId, const FString& FieldId) const
+{
+    if (Entries.ContainsByPredicate([&ItemId, &FieldId](const FGitHubQueuedMutation& Candidate) { return Candidate.ItemId == ItemId && Candidate.FieldId == FieldId; }))
+    {
+        return true;
+    }
+
+    return HasPending(ItemId, FieldId);
+}
+
+void FGitHubMutationQueue::Save()
+{
+    bStagedUnsaved = false;
+
+    IFileManager& FileManager = IFileManager::Get();
+    if (Entries.Num() == 0 && Staged.Num() == 0)
+    {
+        FileManager.Delete(*JournalPath, false, false, true);
+        return;
+    }
+
+    // Staged values are the newest ones and follow the queue, Load brings them back as ordinary entries
+    TArray<const FGitHubQueuedMutation*> Mutations;
+    Mutations.Reserve(Entries.Num() + Staged.Num());
+    for (const FGitHubQueuedMutation& Mutation : Entries)
+    {
+        Mutations.Add(&Mutation);
+    }
+    for (const FStagedMutation& StagedMutation : Staged)
+    {
+        Mutations.Add(&StagedMutation.Mutation);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> MutationValues;
+    MutationValues.Reserve(Mutations.Num());
+    for (const FGitHubQueuedMutation* Mutation : Mutations)
+    {
+        TSharedRef<FJsonObject> MutationObject = MakeShared<FJsonObject>();
+        MutationObject->SetStringField(TEXT("projectId"), Mutation->ProjectId);
+        MutationObject->SetStringField(TEXT("itemId"), Mutation->ItemId);
+        MutationObject->SetStringField(TEXT("fieldId"), Mutation->FieldId);
+        MutationObject->SetStringField(TEXT("kind"), KindToString(Mutation->Kind));
+        MutationObject->SetStringField(TEXT("value"), Mutation->Value);
+        MutationValues.Add(MakeShared<FJsonValueObject>(MutationObject));
+    }
+
+    TSharedRef<FJsonObject> JournalObject = MakeShared<FJsonObject>();
+    JournalObject->SetNumberField(TEXT("version"), JournalVersion);
+    JournalObject->SetArrayField(TEXT("mutations"), MutationValues);
+
+    FString JournalText;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JournalText);
+    FJsonSerializer::Serialize(JournalObject, Writer);
+
+    // Write next to the journal and swap, a crash mid-write must not leave a truncated journal behind
+    const FString TempPath = JournalPath + TEXT(".tmp");
+    if (!FFileHelper::SaveStringToFile(JournalText, *TempPath) || !FileManager.Move(*JournalPath, *TempPath, true, true))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Mutation journal %s could not be written."), *JournalPath);
+    }
+}
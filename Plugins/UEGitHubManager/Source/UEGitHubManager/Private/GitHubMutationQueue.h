@@ -0,0 +1,105 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EGitHubFieldValueKind : uint8
+{
+	Date,
+	SingleSelectOption
+};
+
+enum class EGitHubMutationResult : uint8
+{
+	Applied,
+	Rejected,
+	Retry
+};
+
+// One pending updateProjectV2ItemFieldValue
+struct FGitHubQueuedMutation
+{
+	FString ProjectId;
+	FString ItemId;
+	FString FieldId;
+	EGitHubFieldValueKind Kind = EGitHubFieldValueKind::Date;
+	FString Value;
+};
+
+/**
+ * Durable, ordered journal of pending item field edits.
+ *
+ * A new value for an item and field replaces a queued one that has not been sent yet (last writer wins)
+ * and moves to the back, so five moves of one card leave a single request. The journal is rewritten
+ * on every change, which keeps edits made while offline across editor restarts.
+ *
+ * Edits that arrive in bursts, like dragging a timeline bar, can be staged first: a staged value is only
+ * queued for sending once no newer value for the same item and field has arrived for the debounce interval.
+ * Staged values are kept in memory and only journaled by SaveStaged, which the owner calls on a timer and
+ * before exit, so a drag does not rewrite the journal for every frame. Load restores them as queued edits.
+ * Game thread only.
+ */
+class FGitHubMutationQueue
+{
+public:
+	explicit FGitHubMutationQueue(const FString& InJournalPath);
+
+	// Restores the entries left over from the last session
+	void Load();
+
+	// Returns true if the mutation replaced an older pending value
+	bool Enqueue(const FGitHubQueuedMutation& Mutation);
+
+	// Holds the value back until ReadyTime, a newer value for the same item and field replaces it
+	void Stage(const FGitHubQueuedMutation& Mutation, double ReadyTime);
+
+	// Queues every staged value whose ReadyTime has passed, returns the earliest remaining ReadyTime or 0
+	double EnqueueStaged(double Now);
+
+	// Journals the staged values if they changed since the last write
+	void SaveStaged();
+
+	// Marks the head and all further entries for the same item as in flight, so they go out as one request.
+	// Returns false if the queue is empty or a batch is already being sent.
+	bool BeginNext(TArray<FGitHubQueuedMutation>& OutBatch, int32 MaxBatchSize);
+
+	// Drops the in-flight batch after it was applied or rejected for good
+	void CompleteInFlight();
+
+	// Keeps the in-flight batch at the front for the next attempt
+	void AbortInFlight();
+
+	// Drops the staged or journaled value of an item field that has not been sent yet.
+	// Returns false if there was none or it is already in flight.
+	bool Withdraw(const FString& ItemId, const FString& FieldId);
+
+	// True while a value for the item field is staged or journaled and not yet in flight
+	bool HasPending(const FString& ItemId, const FString& FieldId) const;
+
+	// True while a value for the item field is staged, journaled or in flight, GitHub may not know it yet
+	bool HasUnsettled(const FString& ItemId, const FString& FieldId) const;
+
+	bool IsInFlight() const { return InFlightCount > 0; }
+	int32 Num() const { return Entries.Num() + Staged.Num(); }
+
+private:
+	struct FStagedMutation
+	{
+		FGitHubQueuedMutation Mutation;
+		double ReadyTime = 0.0;
+	};
+
+	bool RemoveUnsent(const FGitHubQueuedMutation& Mutation);
+	void Save();
+
+	FString JournalPath;
+	TArray<FGitHubQueuedMutation> Entries;
+	TArray<FStagedMutation> Staged;
+
+	// The first InFlightCount entries are being sent
+	int32 InFlightCount = 0;
+
+	// Staged values changed after the last journal write
+	bool bStagedUnsaved = false;
+};
@@ -0,0 +1,109 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubPageSizer.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    // Healthy pages in a row before a lowered ceiling is raised again
+    constexpr int32 PagesBeforeProbe = 8;
+
+    // A bigger page has to deliver at least this share of the previous throughput to be kept
+    constexpr double MinThroughputRatio = 0.9;
+}
+
+void FGitHubPageSizer::Register(const FString& Shape, int32 InitialSize, int32 MinSize, int32 MaxSize)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    if (Shapes.Contains(Shape))
+    {
+        return;
+    }
+
+    FShape& Entry = Shapes.Add(Shape);
+    Entry.MinSize = FMath::Max(1, MinSize);
+    Entry.MaxSize = FMath::Max(Entry.MinSize, MaxSize);
+    Entry.PageSize = FMath::Clamp(InitialSize, Entry.MinSize, Entry.MaxSize);
+    Entry.Ceiling = Entry.MaxSize;
+}
+
+int32 FGitHubPageSizer::GetPageSize(const FString& Shape) const
+{
+    FScopeLock ScopeLock(&Lock);
+
+    const FShape* Entry = Shapes.Find(Shape);
+    return Entry ? Entry->PageSize : 100;
+}
+
+void FGitHubPageSizer::ReportPage(const FString& Shape, int32 PageSize, int32 NodeCount, double Seconds, int32 Cost, double TargetSeconds, int32 MaxCost)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    FShape* Entry = Shapes.Find(Shape);
+    if (!Entry)
+    {
+        return;
+    }
+
+    const double ItemsPerSecond = NodeCount / FMath::Max(Seconds, 0.001);
+    const bool bTooSlow = Seconds > TargetSeconds;
+    const bool bTooExpensive = MaxCost > 0 && Cost > MaxCost;
+
+    if (bTooSlow || bTooExpensive)
+    {
+        Entry->Ceiling = FMath::Max(Entry->MinSize, PageSize - 1);
+        Entry->PageSize = FMath::Clamp(PageSize * 3 / 4, Entry->MinSize, Entry->Ceiling);
+        Entry->HealthyPages = 0;
+        Entry->PreviousSize = 0;
+        return;
+    }
+
+    if (++Entry->HealthyPages >= PagesBeforeProbe && Entry->Ceiling < Entry->MaxSize)
+    {
+        Entry->Ceiling = FMath::Min(Entry->MaxSize, Entry->Ceiling + FMath::Max(1, Entry->Ceiling / 4));
+        Entry->HealthyPages = 0;
+    }
+
+    // A partial page is the end of the list, it says nothing about larger pages
+    if (NodeCount < PageSize || PageSize != Entry->PageSize)
+    {
+        return;
+    }
+
+    // The last growth step did not pay off, go back and do not try it again for a while
+    if (Entry->PreviousSize > 0 && PageSize > Entry->PreviousSize && ItemsPerSecond < Entry->PreviousItemsPerSecond * MinThroughputRatio)
+    {
+        Entry->Ceiling = Entry->PreviousSize;
+        Entry->PageSize = Entry->PreviousSize;
+        Entry->PreviousSize = 0;
+        Entry->HealthyPages = 0;
+        return;
+    }
+
+    // Grow only while the page stays well inside the latency target
+    if (Seconds < TargetSeconds * 0.5 && Entry->PageSize < Entry->Ceiling)
+    {
+        Entry->PreviousSize = PageSize;
+        Entry->PreviousItemsPerSecond = ItemsPerSecond;
+        Entry->PageSize = FMath::Min(Entry->Ceiling, PageSize + FMath::Max(1, PageSize / 2));
+    }
+}
+
+int32 FGitHubPageSizer::ReportOversized(const FString& Shape, int32 PageSize)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    FShape* Entry = Shapes.Find(Shape);
+    if (!Entry || PageSize <= Entry->MinSize)
+    {
+        return 0;
+    }
+
+    Entry->Ceiling = FMath::Max(Entry->MinSize, PageSize / 2);
+    Entry->PageSize = Entry->Ceiling;
+    Entry->HealthyPages = 0;
+    Entry->PreviousSize = 0;
+    return Entry->PageSize;
+}
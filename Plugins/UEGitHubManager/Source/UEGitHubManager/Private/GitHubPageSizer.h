@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Page size per paged query shape ("Repositories", "Projects", "ProjectItems"), tuned from the pages it sees.
+ *
+ * A page that comes back full, well inside the latency target and below the cost budget lets the next one grow.
+ * A slow or expensive page shrinks it, and a page GitHub refuses as too large (node limit, timeout) is split in
+ * half and asked for again. When a bigger page does not deliver more items per second, the size steps back and
+ * stays below that ceiling until a run of healthy pages probes upwards again. Thread-safe.
+ */
+class FGitHubPageSizer
+{
+public:
+	void Register(const FString& Shape, int32 InitialSize, int32 MinSize, int32 MaxSize);
+
+	int32 GetPageSize(const FString& Shape) const;
+
+	// A page of PageSize arrived with NodeCount nodes after Seconds, for Cost rate limit points (0 if unknown)
+	void ReportPage(const FString& Shape, int32 PageSize, int32 NodeCount, double Seconds, int32 Cost, double TargetSeconds, int32 MaxCost);
+
+	// GitHub refused a page of PageSize as too large. Returns the size to retry with, 0 if it cannot get any smaller.
+	int32 ReportOversized(const FString& Shape, int32 PageSize);
+
+private:
+	struct FShape
+	{
+		int32 PageSize = 0;
+		int32 MinSize = 1;
+		int32 MaxSize = 1;
+
+		// Largest size worth trying right now, lowered by slow, expensive or unproductive pages
+		int32 Ceiling = 1;
+		int32 HealthyPages = 0;
+
+		// Size and throughput before the last growth step
+		int32 PreviousSize = 0;
+		double PreviousItemsPerSecond = 0.0;
+	};
+
+	mutable FCriticalSection Lock;
+	TMap<FString, FShape> Shapes;
+};
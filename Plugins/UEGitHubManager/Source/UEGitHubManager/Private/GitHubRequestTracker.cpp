@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubRequestTracker.h"
+#include "Misc/ScopeLock.h"
+
+FGitHubRequestHandle FGitHubRequestTracker::Begin(const FString& Slot, const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>& OutSuperseded)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    FSlot& Entry = Slots.FindOrAdd(Slot);
+    OutSuperseded = Entry.Request.Pin();
+    Entry.Request = Request;
+
+    FGitHubRequestHandle Handle;
+    Handle.Slot = Slot;
+    Handle.Generation = ++Entry.Generation;
+    return Handle;
+}
+
+FGitHubRequestHandle FGitHubRequestTracker::Begin(const FString& Slot, TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>& OutSuperseded)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    FSlot& Entry = Slots.FindOrAdd(Slot);
+    OutSuperseded = Entry.Request.Pin();
+    Entry.Request.Reset();
+
+    FGitHubRequestHandle Handle;
+    Handle.Slot = Slot;
+    Handle.Generation = ++Entry.Generation;
+    return Handle;
+}
+
+bool FGitHubRequestTracker::Attach(const FGitHubRequestHandle& Handle, const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    FSlot* Entry = Slots.Find(Handle.Slot);
+    if (!Entry || Entry->Generation != Handle.Generation)
+    {
+        return false;
+    }
+
+    Entry->Request = Request;
+    return true;
+}
+
+TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> FGitHubRequestTracker::Invalidate(const FString& Slot)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    FSlot* Entry = Slots.Find(Slot);
+    if (!Entry)
+    {
+        return nullptr;
+    }
+
+    ++Entry->Generation;
+    TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Superseded = Entry->Request.Pin();
+    Entry->Request.Reset();
+    return Superseded;
+}
+
+bool FGitHubRequestTracker::IsCurrent(const FGitHubRequestHandle& Handle) const
+{
+    if (!Handle.IsSet())
+    {
+        return true;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+
+    const FSlot* Entry = Slots.Find(Handle.Slot);
+    return Entry && Entry->Generation == Handle.Generation;
+}
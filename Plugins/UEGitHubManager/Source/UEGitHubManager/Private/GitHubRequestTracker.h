@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "HAL/CriticalSection.h"
+
+// Identifies one request within a slot, a newer request in the same slot makes it stale
+struct FGitHubRequestHandle
+{
+	FString Slot;
+	uint32 Generation = 0;
+
+	bool IsSet() const { return !Slot.IsEmpty(); }
+};
+
+/**
+ * Generation counter per request slot ("ProjectDetails", "RepositoryDetails", ...).
+ *
+ * Starting a request in a slot supersedes the previous one; its response is dropped before it is
+ * decoded, and the request itself is handed back so it can be cancelled. IsCurrent is safe to call
+ * from worker threads.
+ */
+class FGitHubRequestTracker
+{
+public:
+	// Starts a new generation in Slot and returns the request it supersedes, if that one is still around
+	FGitHubRequestHandle Begin(const FString& Slot, const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request, TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>& OutSuperseded);
+
+	// Starts a new generation in Slot for a load of several requests, each one is attached once it is sent
+	FGitHubRequestHandle Begin(const FString& Slot, TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>& OutSuperseded);
+
+	// Makes Request the one in flight for Handle, false if a newer generation superseded Handle meanwhile
+	bool Attach(const FGitHubRequestHandle& Handle, const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request);
+
+	// Makes every outstanding request of Slot stale, returns the one that was in flight
+	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Invalidate(const FString& Slot);
+
+	bool IsCurrent(const FGitHubRequestHandle& Handle) const;
+
+private:
+	struct FSlot
+	{
+		uint32 Generation = 0;
+		TWeakPtr<IHttpRequest, ESPMode::ThreadSafe> Request;
+	};
+
+	mutable FCriticalSection Lock;
+	TMap<FString, FSlot> Slots;
+};
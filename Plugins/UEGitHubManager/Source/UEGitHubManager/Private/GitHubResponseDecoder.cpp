@@ -0,0 +1,132 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubResponseDecoder.h"
+#include "GitHubTrace.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace
+{
+    constexpr int32 InflateChunkSize = 64 * 1024;
+
+    bool HasGzipMagic(const TArray<uint8>& Data)
+    {
+        return Data.Num() >= 2 && Data[0] == 0x1f && Data[1] == 0x8b;
+    }
+
+    bool HasZlibMagic(const TArray<uint8>& Data)
+    {
+        // CMF must announce deflate and the header checksum must divide by 31, plain JSON never matches
+        return Data.Num() >= 2 && (Data[0] & 0x0f) == 8 && ((Data[0] << 8) | Data[1]) % 31 == 0;
+    }
+
+    bool LooksLikeText(const TArray<uint8>& Data)
+    {
+        for (uint8 Byte : Data)
+        {
+            if (Byte == ' ' || Byte == '\t' || Byte == '\r' || Byte == '\n')
+            {
+                continue;
+            }
+            return Byte == '{' || Byte == '[' || Byte == '"';
+        }
+        return true;
+    }
+
+    // WindowBits: 15 + 32 auto-detects gzip or zlib headers, -15 reads raw deflate
+    bool Inflate(const TArray<uint8>& Compressed, int32 WindowBits, TArray<uint8>& OutData)
+    {
+        GITHUB_TRACE_SCOPE(GitHub_Inflate);
+
+        z_stream Stream;
+        FMemory::Memzero(Stream);
+        if (inflateInit2(&Stream, WindowBits) != Z_OK)
+        {
+            return false;
+        }
+
+        Stream.next_in = const_cast<Bytef*>(Compressed.GetData());
+        Stream.avail_in = Compressed.Num();
+
+        // JSON typically inflates 8-12x, start there to avoid most regrowth
+        OutData.Reset();
+        OutData.Reserve(Compressed.Num() * 8);
+
+        int32 Result = Z_OK;
+        while (Result == Z_OK)
+        {
+            const int32 Offset = OutData.Num();
+            OutData.AddUninitialized(InflateChunkSize);
+            Stream.next_out = OutData.GetData() + Offset;
+            Stream.avail_out = InflateChunkSize;
+
+            Result = inflate(&Stream, Z_NO_FLUSH);
+            OutData.SetNum(Offset + InflateChunkSize - Stream.avail_out, EAllowShrinking::No);
+        }
+
+        // Output space is always available, so Z_BUF_ERROR means the input ended before the stream did. A truncated
+        // body would parse as broken JSON at best, or as a valid prefix of it at worst.
+        inflateEnd(&Stream);
+        return Result == Z_STREAM_END;
+    }
+}
+
+bool GitHubResponseDecoder::Decode(const FHttpResponsePtr& Response, FGitHubDecodedBody& OutBody)
+{
+    GITHUB_TRACE_SCOPE(GitHub_DecodeBody);
+
+    if (!Response.IsValid())
+    {
+        return false;
+    }
+
+    const TArray<uint8>& Content = Response->GetContent();
+    const FString Encoding = Response->GetHeader(TEXT("Content-Encoding")).ToLower();
+    const bool bServerCompressed = Encoding.Contains(TEXT("gzip")) || Encoding.Contains(TEXT("deflate"));
+
+    OutBody.WireBytes = Content.Num();
+
+    const TArray<uint8>* Utf8 = &Content;
+    TArray<uint8> Inflated;
+
+    if (bServerCompressed)
+    {
+        bool bInflated = false;
+        if (HasGzipMagic(Content) || HasZlibMagic(Content))
+        {
+            bInflated = Inflate(Content, 15 + 32, Inflated);
+        }
+        else if (Encoding.Contains(TEXT("deflate")) && !LooksLikeText(Content))
+        {
+            bInflated = Inflate(Content, -15, Inflated);
+        }
+        else
+        {
+            // The HTTP backend already inflated the body, the wire size is only known from the header
+            const FString ContentLength = Response->GetHeader(TEXT("Content-Length"));
+            if (!ContentLength.IsEmpty())
+            {
+                OutBody.WireBytes = FCString::Atoi64(*ContentLength);
+            }
+        }
+
+        if (bInflated)
+        {
+            Utf8 = &Inflated;
+        }
+        else if (!LooksLikeText(Content))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to inflate %s response body (%d bytes)."), *Encoding, Content.Num());
+            return false;
+        }
+    }
+
+    OutBody.DecodedBytes = Utf8->Num();
+
+    FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Utf8->GetData()), Utf8->Num());
+    OutBody.Text = FString(Converter.Length(), Converter.Get());
+    return true;
+}
@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpResponse.h"
+
+/** Value sent as Accept-Encoding on every API request. */
+#define GITHUB_ACCEPT_ENCODING TEXT("gzip, deflate")
+
+struct FGitHubDecodedBody
+{
+	FString Text;
+
+	// Bytes as they travelled over the network (compressed size if the server compressed)
+	int64 WireBytes = 0;
+
+	// UTF-8 bytes after inflation
+	int64 DecodedBytes = 0;
+};
+
+namespace GitHubResponseDecoder
+{
+	/**
+	 * Converts the response payload to text, inflating gzip/deflate bodies with a streaming zlib pass.
+	 * Bodies already inflated by the HTTP backend are detected by their magic bytes and passed through.
+	 * Safe to call from worker threads.
+	 */
+	bool Decode(const FHttpResponsePtr& Response, FGitHubDecodedBody& OutBody);
+}
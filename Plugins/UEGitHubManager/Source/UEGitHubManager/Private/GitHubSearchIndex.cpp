@@ -0,0 +1,298 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubSearchIndex.h"
+#include "UGitHubAPIManager.h"
+#include "Algo/BinarySearch.h"
+
+namespace
+{
+    // Titles dominate the ranking, bodies only break ties between otherwise equal matches
+    constexpr float TitleWeight = 3.0f;
+    constexpr float ColumnWeight = 2.0f;
+    constexpr float StateWeight = 1.5f;
+    constexpr float TypeWeight = 1.5f;
+    constexpr float BodyWeight = 1.0f;
+
+    // A term that only starts with the query word counts less than an exact word match
+    constexpr float PrefixMatchFactor = 0.6f;
+
+    // Byte-wise ordering, the same one the prefix scan relies on
+    bool TermLess(const FString& A, const FString& B)
+    {
+        return A.Compare(B, ESearchCase::CaseSensitive) < 0;
+    }
+
+    uint32 HashIndexedText(const FProjectItem& Item)
+    {
+        uint32 Hash = GetTypeHash(Item.Title);
+        Hash = HashCombine(Hash, GetTypeHash(Item.Body));
+        Hash = HashCombine(Hash, GetTypeHash(Item.State));
+        Hash = HashCombine(Hash, GetTypeHash(Item.Type));
+        return HashCombine(Hash, GetTypeHash(Item.ColumnName));
+    }
+}
+
+void FGitHubSearchIndex::Tokenize(const FString& Text, TArray<FString>& OutTokens)
+{
+    FString Token;
+    for (TCHAR Character : Text)
+    {
+        if (FChar::IsAlnum(Character))
+        {
+            Token.AppendChar(FChar::ToLower(Character));
+        }
+        else if (!Token.IsEmpty())
+        {
+            OutTokens.Add(MoveTemp(Token));
+            Token.Reset();
+        }
+    }
+
+    if (!Token.IsEmpty())
+    {
+        OutTokens.Add(MoveTemp(Token));
+    }
+}
+
+void FGitHubSearchIndex::UpdateItem(const FProjectItem& Item)
+{
+    const uint32 TextHash = HashIndexedText(Item);
+
+    int32 DocumentId;
+    if (const int32* ExistingId = DocumentByItemId.Find(Item.ItemId))
+    {
+        DocumentId = *ExistingId;
+        if (Documents[DocumentId].TextHash == TextHash)
+        {
+            return;
+        }
+        ClearDocument(DocumentId);
+    }
+    else
+    {
+        DocumentId = FreeDocuments.Num() > 0 ? FreeDocuments.Pop(EAllowShrinking::No) : Documents.AddDefaulted();
+        Documents[DocumentId].ItemId = Item.ItemId;
+        DocumentByItemId.Add(Item.ItemId, DocumentId);
+    }
+
+    Documents[DocumentId].TextHash = TextHash;
+
+    // Every field contributes its weight once per distinct word
+    TMap<FString, float> TermWeights;
+    TArray<FString> Tokens;
+    auto AddField = [&TermWeights, &Tokens](const FString& Text, float Weight)
+        {
+            Tokens.Reset();
+            Tokenize(Text, Tokens);
+
+            TSet<FString> Seen;
+            for (FString& Token : Tokens)
+            {
+                bool bAlreadySeen = false;
+                Seen.Add(Token, &bAlreadySeen);
+                if (!bAlreadySeen)
+                {
+                    TermWeights.FindOrAdd(MoveTemp(Token)) += Weight;
+                }
+            }
+        };
+
+    AddField(Item.Title, TitleWeight);
+    AddField(Item.ColumnName, ColumnWeight);
+    AddField(Item.State, StateWeight);
+    AddField(Item.Type, TypeWeight);
+    AddField(Item.Body, BodyWeight);
+
+    for (const TPair<FString, float>& TermWeight : TermWeights)
+    {
+        AddTerm(DocumentId, TermWeight.Key, TermWeight.Value);
+    }
+}
+
+void FGitHubSearchIndex::RemoveItem(const FString& ItemId)
+{
+    int32 DocumentId;
+    if (DocumentByItemId.RemoveAndCopyValue(ItemId, DocumentId))
+    {
+        ClearDocument(DocumentId);
+        Documents[DocumentId].ItemId.Reset();
+        Documents[DocumentId].TextHash = 0;
+        FreeDocuments.Add(DocumentId);
+    }
+}
+
+void FGitHubSearchIndex::SyncItems(const TArray<FProjectItem>& Items)
+{
+    TSet<FString> CurrentItemIds;
+    CurrentItemIds.Reserve(Items.Num());
+
+    for (const FProjectItem& Item : Items)
+    {
+        CurrentItemIds.Add(Item.ItemId);
+        UpdateItem(Item);
+    }
+
+    TArray<FString> RemovedItemIds;
+    for (const TPair<FString, int32>& Pair : DocumentByItemId)
+    {
+        if (!CurrentItemIds.Contains(Pair.Key))
+        {
+            RemovedItemIds.Add(Pair.Key);
+        }
+    }
+
+    for (const FString& ItemId : RemovedItemIds)
+    {
+        RemoveItem(ItemId);
+    }
+}
+
+TArray<FString> FGitHubSearchIndex::Search(const FString& Query, int32 MaxResults) const
+{
+    TArray<FString> QueryTerms;
+    Tokenize(Query, QueryTerms);
+    if (QueryTerms.Num() == 0 || MaxResults <= 0)
+    {
+        return TArray<FString>();
+    }
+
+    EnsureVocabularySorted();
+
+    TMap<int32, float> Scores;
+    for (int32 TermIndex = 0; TermIndex < QueryTerms.Num(); ++TermIndex)
+    {
+        const FString& Prefix = QueryTerms[TermIndex];
+
+        // All vocabulary terms starting with Prefix form one contiguous run in the sorted vocabulary
+        TMap<int32, float> TermScores;
+        for (int32 VocabularyIndex = Algo::LowerBound(Vocabulary, Prefix, TermLess); VocabularyIndex < Vocabulary.Num(); ++VocabularyIndex)
+        {
+            const FString& Term = Vocabulary[VocabularyIndex];
+            if (!Term.StartsWith(Prefix, ESearchCase::CaseSensitive))
+            {
+                break;
+            }
+
+            const float Factor = Term.Len() == Prefix.Len() ? 1.0f : PrefixMatchFactor;
+            for (const TPair<int32, float>& Posting : Postings.FindChecked(Term))
+            {
+                float& Score = TermScores.FindOrAdd(Posting.Key);
+                Score = FMath::Max(Score, Posting.Value * Factor);
+            }
+        }
+
+        if (TermIndex == 0)
+        {
+            Scores = MoveTemp(TermScores);
+        }
+        else
+        {
+            // Every query word has to match
+            for (auto It = Scores.CreateIterator(); It; ++It)
+            {
+                if (const float* TermScore = TermScores.Find(It.Key()))
+                {
+                    It.Value() += *TermScore;
+                }
+                else
+                {
+                    It.RemoveCurrent();
+                }
+            }
+        }
+
+        if (Scores.Num() == 0)
+        {
+            return TArray<FString>();
+        }
+    }
+
+    TArray<TPair<int32, float>> Ranked = Scores.Array();
+    Ranked.Sort([this](const TPair<int32, float>& A, const TPair<int32, float>& B)
+        {
+            return A.Value != B.Value ? A.Value > B.Value : Documents[A.Key].ItemId < Documents[B.Key].ItemId;
+        });
+
+    TArray<FString> Result;
+    Result.Reserve(FMath::Min(MaxResults, Ranked.Num()));
+    for (int32 Index = 0; Index < Ranked.Num() && Index < MaxResults; ++Index)
+    {
+        Result.Add(Documents[Ranked[Index].Key].ItemId);
+    }
+    return Result;
+}
+
+SIZE_T FGitHubSearchIndex::GetAllocatedSize() const
+{
+    SIZE_T Size = Documents.GetAllocatedSize() + FreeDocuments.GetAllocatedSize() + DocumentByItemId.GetAllocatedSize()
+        + Postings.GetAllocatedSize() + Vocabulary.GetAllocatedSize();
+
+    for (const FDocument& Document : Documents)
+    {
+        Size += Document.ItemId.GetAllocatedSize() + Document.Terms.GetAllocatedSize();
+        for (const FString& Term : Document.Terms)
+        {
+            Size += Term.GetAllocatedSize();
+        }
+    }
+
+    for (const TPair<FString, int32>& Entry : DocumentByItemId)
+    {
+        Size += Entry.Key.GetAllocatedSize();
+    }
+
+    for (const TPair<FString, TMap<int32, float>>& Posting : Postings)
+    {
+        Size += Posting.Key.GetAllocatedSize() + Posting.Value.GetAllocatedSize();
+    }
+
+    for (const FString& Term : Vocabulary)
+    {
+        Size += Term.GetAllocatedSize();
+    }
+    return Size;
+}
+
+void FGitHubSearchIndex::AddTerm(int32 DocumentId, const FString& Term, float Weight)
+{
+    TMap<int32, float>* TermPostings = Postings.Find(Term);
+    if (!TermPostings)
+    {
+        TermPostings = &Postings.Add(Term);
+        bVocabularyDirty = true;
+    }
+
+    TermPostings->Add(DocumentId, Weight);
+    Documents[DocumentId].Terms.Add(Term);
+}
+
+void FGitHubSearchIndex::ClearDocument(int32 DocumentId)
+{
+    for (const FString& Term : Documents[DocumentId].Terms)
+    {
+        if (TMap<int32, float>* TermPostings = Postings.Find(Term))
+        {
+            TermPostings->Remove(DocumentId);
+            if (TermPostings->Num() == 0)
+            {
+                Postings.Remove(Term);
+                bVocabularyDirty = true;
+            }
+        }
+    }
+
+    Documents[DocumentId].Terms.Reset();
+}
+
+void FGitHubSearchIndex::EnsureVocabularySorted() const
+{
+    if (!bVocabularyDirty)
+    {
+        return;
+    }
+
+    Postings.GenerateKeyArray(Vocabulary);
+    Vocabulary.Sort(TermLess);
+    bVocabularyDirty = false;
+}
@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FProjectItem;
+
+/**
+ * Tokenized inverted index over the items of one project board.
+ * Covers title, body, state, type and column name; every query term matches as a prefix.
+ * Items are re-tokenized only when their indexed text changes. Game thread only.
+ */
+class FGitHubSearchIndex
+{
+public:
+	void UpdateItem(const FProjectItem& Item);
+	void RemoveItem(const FString& ItemId);
+
+	// Indexes Items and drops every indexed item that is not part of it
+	void SyncItems(const TArray<FProjectItem>& Items);
+
+	// Item IDs matching all query terms, best match first
+	TArray<FString> Search(const FString& Query, int32 MaxResults) const;
+
+	int32 Num() const { return DocumentByItemId.Num(); }
+
+	// Heap memory held by the index, for the board cache budget
+	SIZE_T GetAllocatedSize() const;
+
+	static void Tokenize(const FString& Text, TArray<FString>& OutTokens);
+
+private:
+	struct FDocument
+	{
+		FString ItemId;
+		uint32 TextHash = 0;
+		TArray<FString> Terms;
+	};
+
+	void AddTerm(int32 DocumentId, const FString& Term, float Weight);
+	void ClearDocument(int32 DocumentId);
+	void EnsureVocabularySorted() const;
+
+	TArray<FDocument> Documents;
+	TArray<int32> FreeDocuments;
+	TMap<FString, int32> DocumentByItemId;
+
+	// Term -> (document -> weight)
+	TMap<FString, TMap<int32, float>> Postings;
+
+	// Sorted copy of the Postings keys for prefix lookups, rebuilt lazily after new terms appear
+	mutable TArray<FString> Vocabulary;
+	mutable bool bVocabularyDirty = false;
+};
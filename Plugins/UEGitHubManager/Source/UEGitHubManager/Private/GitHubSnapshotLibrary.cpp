@@ -0,0 +1,132 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubSnapshotLibrary.h"
+
+bool UGitHubSnapshotLibrary::IsValidBoard(const FGitHubBoardHandle& Board)
+{
+    return Board.IsValid();
+}
+
+FString UGitHubSnapshotLibrary::GetBoardProjectId(const FGitHubBoardHandle& Board)
+{
+    return Board.IsValid() ? Board.Get()->ProjectId : FString();
+}
+
+FString UGitHubSnapshotLibrary::GetBoardTitle(const FGitHubBoardHandle& Board)
+{
+    return Board.IsValid() ? Board.Get()->ProjectTitle : FString();
+}
+
+TArray<FColumnInfo> UGitHubSnapshotLibrary::GetBoardColumns(const FGitHubBoardHandle& Board)
+{
+    return Board.IsValid() ? Board.Get()->Columns : TArray<FColumnInfo>();
+}
+
+int32 UGitHubSnapshotLibrary::GetBoardItemCount(const FGitHubBoardHandle& Board)
+{
+    return Board.IsValid() ? Board.Get()->Items.Num() : 0;
+}
+
+bool UGitHubSnapshotLibrary::GetBoardItem(const FGitHubBoardHandle& Board, int32 Index, FProjectItem& OutItem)
+{
+    if (!Board.IsValid() || !Board.Get()->Items.IsValidIndex(Index))
+    {
+        return false;
+    }
+
+    OutItem = Board.Get()->Items[Index];
+    return true;
+}
+
+bool UGitHubSnapshotLibrary::FindBoardItem(const FGitHubBoardHandle& Board, const FString& ItemId, FProjectItem& OutItem)
+{
+    if (!Board.IsValid())
+    {
+        return false;
+    }
+
+    const FProjectItem* Item = Board.Get()->Items.FindByPredicate([&ItemId](const FProjectItem& Candidate) { return Candidate.ItemId == ItemId; });
+    if (!Item)
+    {
+        return false;
+    }
+
+    OutItem = *Item;
+    return true;
+}
+
+TArray<FProjectItem> UGitHubSnapshotLibrary::GetBoardItemsInColumn(const FGitHubBoardHandle& Board, const FString& ColumnId)
+{
+    TArray<FProjectItem> Result;
+    if (Board.IsValid())
+    {
+        for (const FProjectItem& Item : Board.Get()->Items)
+        {
+            if (Item.ColumnId == ColumnId)
+            {
+                Result.Add(Item);
+            }
+        }
+    }
+    return Result;
+}
+
+bool UGitHubSnapshotLibrary::IsValidProjectList(const FGitHubProjectListHandle& Projects)
+{
+    return Projects.IsValid();
+}
+
+int32 UGitHubSnapshotLibrary::GetProjectCount(const FGitHubProjectListHandle& Projects)
+{
+    return Projects.IsValid() ? Projects.Get()->Num() : 0;
+}
+
+bool UGitHubSnapshotLibrary::GetProject(const FGitHubProjectListHandle& Projects, int32 Index, FProjectInfo& OutProject)
+{
+    if (!Projects.IsValid() || !Projects.Get()->IsValidIndex(Index))
+    {
+        return false;
+    }
+
+    OutProject = (*Projects.Get())[Index];
+    return true;
+}
+
+bool UGitHubSnapshotLibrary::IsValidRepositoryList(const FGitHubRepositoryListHandle& Repositories)
+{
+    return Repositories.IsValid();
+}
+
+int32 UGitHubSnapshotLibrary::GetRepositoryCount(const FGitHubRepositoryListHandle& Repositories)
+{
+    return Repositories.IsValid() ? Repositories.Get()->Num() : 0;
+}
+
+bool UGitHubSnapshotLibrary::GetRepository(const FGitHubRepositoryListHandle& Repositories, int32 Index, FRepositoryInfo& OutRepository)
+{
+    if (!Repositories.IsValid() || !Repositories.Get()->IsValidIndex(Index))
+    {
+        return false;
+    }
+
+    OutRepository = (*Repositories.Get())[Index];
+    return true;
+}
+
+bool UGitHubSnapshotLibrary::FindRepository(const FGitHubRepositoryListHandle& Repositories, const FString& RepositoryName, FRepositoryInfo& OutRepository)
+{
+    if (!Repositories.IsValid())
+    {
+        return false;
+    }
+
+    const FRepositoryInfo* Repository = Repositories.Get()->FindByPredicate([&RepositoryName](const FRepositoryInfo& Candidate) { return Candidate.RepositoryName == RepositoryName; });
+    if (!Repository)
+    {
+        return false;
+    }
+
+    OutRepository = *Repository;
+    return true;
+}
@@ -0,0 +1,33 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubStateStore.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
+
+FGitHubStateStore::FGitHubStateStore()
+    : Current(MakeShared<const FGitHubManagerState, ESPMode::ThreadSafe>())
+{
+}
+
+FGitHubStateSnapshot FGitHubStateStore::Read() const
+{
+    FReadScopeLock ScopeLock(PointerLock);
+    return Current;
+}
+
+FGitHubStateSnapshot FGitHubStateStore::Update(TFunctionRef<void(FGitHubManagerState&)> Mutation)
+{
+    FScopeLock ScopeLock(&WriteLock);
+
+    // Only writers replace Current and they hold WriteLock, so reading it here needs no pointer lock
+    TSharedRef<FGitHubManagerState, ESPMode::ThreadSafe> Next = MakeShared<FGitHubManagerState, ESPMode::ThreadSafe>(*Current);
+    Mutation(*Next);
+    Next->Version = Current->Version + 1;
+
+    {
+        FWriteScopeLock PointerScopeLock(PointerLock);
+        Current = Next;
+    }
+    return Next;
+}
@@ -0,0 +1,56 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "UGitHubAPIManager.h"
+
+// One published version of the manager's shared state. Never modified once published.
+struct FGitHubManagerState
+{
+	uint64 Version = 0;
+
+	TMap<FString, FRepositoryInfo> RepositoryInfos;
+
+	// Keyed by title, or "Owner/Title" when two owners use the same title
+	TMap<FString, FProjectInfo> UserProjects;
+
+	FRepositoryInfo ActiveRepository;
+
+	// The same data in publishing order, shared with snapshot handles
+	TSharedPtr<const TArray<FRepositoryInfo>, ESPMode::ThreadSafe> RepositoryList;
+	TSharedPtr<const TArray<FProjectInfo>, ESPMode::ThreadSafe> ProjectList;
+};
+
+using FGitHubStateSnapshot = TSharedRef<const FGitHubManagerState, ESPMode::ThreadSafe>;
+
+/**
+ * Read-copy-update store for the manager state.
+ *
+ * Readers take a short read lock to copy the snapshot pointer, then work on the immutable snapshot
+ * without the lock; the version they hold never changes. Writers copy the current version, apply
+ * their change and publish the copy as the next version. Writers are serialized among themselves and
+ * only take the write lock to swap the pointer, so a slow writer never stalls a reader. Safe to use
+ * from any thread.
+ */
+class FGitHubStateStore
+{
+public:
+	FGitHubStateStore();
+
+	FGitHubStateSnapshot Read() const;
+
+	// Publishes Mutation applied to a copy of the current version and returns the new version
+	FGitHubStateSnapshot Update(TFunctionRef<void(FGitHubManagerState&)> Mutation);
+
+	uint64 GetVersion() const { return Read()->Version; }
+
+private:
+	// Serializes writers, held for the copy and the mutation
+	FCriticalSection WriteLock;
+
+	// Guards only the Current pointer itself
+	mutable FRWLock PointerLock;
+	FGitHubStateSnapshot Current;
+};
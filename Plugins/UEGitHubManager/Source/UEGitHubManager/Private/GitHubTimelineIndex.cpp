@@ -0,0 +1,304 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubTimelineIndex.h"
+#include "UGitHubAPIManager.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+
+namespace
+{
+    // Unset dates stay at the default FDateTime (tick 0)
+    bool IsDateSet(const FDateTime& Date)
+    {
+        return Date.GetTicks() > 0;
+    }
+}
+
+bool FGitHubTimelineIndex::StartLess(const FInterval& A, const FInterval& B)
+{
+    return A.Start != B.Start ? A.Start < B.Start : A.ItemId.Compare(B.ItemId, ESearchCase::CaseSensitive) < 0;
+}
+
+bool FGitHubTimelineIndex::EndLess(const FInterval& A, const FInterval& B)
+{
+    return A.End != B.End ? A.End < B.End : A.ItemId.Compare(B.ItemId, ESearchCase::CaseSensitive) < 0;
+}
+
+bool FGitHubTimelineIndex::MakeInterval(const FProjectItem& Item, FInterval& OutInterval)
+{
+    const bool bHasStart = IsDateSet(Item.StartDateTime);
+    const bool bHasEnd = IsDateSet(Item.EndDateTime);
+
+    if (!bHasStart && !bHasEnd)
+    {
+        return false;
+    }
+
+    OutInterval.ItemId = Item.ItemId;
+    OutInterval.Start = bHasStart ? Item.StartDateTime : Item.EndDateTime;
+    OutInterval.End = bHasEnd ? Item.EndDateTime : Item.StartDateTime;
+
+    // Reversed ranges are indexed the way they render, from the earlier to the later date
+    if (OutInterval.End < OutInterval.Start)
+    {
+        Swap(OutInterval.Start, OutInterval.End);
+    }
+    return true;
+}
+
+void FGitHubTimelineIndex::UpdateItem(const FProjectItem& Item)
+{
+    FInterval Interval;
+    if (!MakeInterval(Item, Interval))
+    {
+        RemoveItem(Item.ItemId);
+        return;
+    }
+
+    if (FInterval* Existing = IntervalByItemId.Find(Item.ItemId))
+    {
+        if (Existing->Start == Interval.Start && Existing->End == Interval.End)
+        {
+            return;
+        }
+
+        if (!Replace(*Existing, Interval))
+        {
+            Remove(*Existing);
+            Insert(Interval);
+        }
+        *Existing = MoveTemp(Interval);
+        return;
+    }
+
+    Insert(Interval);
+    IntervalByItemId.Add(Item.ItemId, MoveTemp(Interval));
+}
+
+void FGitHubTimelineIndex::RemoveItem(const FString& ItemId)
+{
+    FInterval Interval;
+    if (IntervalByItemId.RemoveAndCopyValue(ItemId, Interval))
+    {
+        Remove(Interval);
+    }
+}
+
+void FGitHubTimelineIndex::SyncItems(const TArray<FProjectItem>& Items)
+{
+    // Rebuilt as a whole and sorted once, inserting item by item shifts both arrays for every item
+    IntervalByItemId.Reset();
+    IntervalByItemId.Reserve(Items.Num());
+    ByStart.Reset(Items.Num());
+
+    for (const FProjectItem& Item : Items)
+    {
+        FInterval Interval;
+        if (MakeInterval(Item, Interval) && !IntervalByItemId.Contains(Item.ItemId))
+        {
+            ByStart.Add(Interval);
+            IntervalByItemId.Add(Item.ItemId, MoveTemp(Interval));
+        }
+    }
+
+    ByEnd = ByStart;
+    Algo::Sort(ByStart, StartLess);
+    Algo::Sort(ByEnd, EndLess);
+    bTreeDirty = true;
+}
+
+TArray<FString> FGitHubTimelineIndex::QueryOverlapping(const FDateTime& From, const FDateTime& To) const
+{
+    TArray<FString> Result;
+    if (To < From || ByStart.Num() == 0)
+    {
+        return Result;
+    }
+
+    EnsureTreeBuilt();
+    CollectOverlapping(0, ByStart.Num(), From, To, Result);
+    return Result;
+}
+
+TArray<FString> FGitHubTimelineIndex::QueryContained(const FDateTime& From, const FDateTime& To) const
+{
+    TArray<FString> Result;
+    if (To < From)
+    {
+        return Result;
+    }
+
+    // Contained intervals start inside the range, so only that run of ByStart has to be looked at
+    const int32 First = Algo::LowerBoundBy(ByStart, From, [](const FInterval& Interval) { return Interval.Start; });
+    for (int32 Index = First; Index < ByStart.Num() && ByStart[Index].Start <= To; ++Index)
+    {
+        if (ByStart[Index].End <= To)
+        {
+            Result.Add(ByStart[Index].ItemId);
+        }
+    }
+    return Result;
+}
+
+TArray<FString> FGitHubTimelineIndex::QueryNextDue(const FDateTime& After, int32 Count) const
+{
+    TArray<FString> Result;
+    if (Count <= 0)
+    {
+        return Result;
+    }
+
+    const int32 First = Algo::LowerBoundBy(ByEnd, After, [](const FInterval& Interval) { return Interval.End; });
+    for (int32 Index = First; Index < ByEnd.Num() && Result.Num() < Count; ++Index)
+    {
+        Result.Add(ByEnd[Index].ItemId);
+    }
+    return Result;
+}
+
+SIZE_T FGitHubTimelineIndex::GetAllocatedSize() const
+{
+    SIZE_T Size = ByStart.GetAllocatedSize() + ByEnd.GetAllocatedSize() + IntervalByItemId.GetAllocatedSize() + SubtreeMaxEnd.GetAllocatedSize();
+
+    // Every interval is held three times, each copy with its own item id
+    for (const FInterval& Interval : ByStart)
+    {
+        Size += Interval.ItemId.GetAllocatedSize() * 3;
+    }
+    return Size;
+}
+
+void FGitHubTimelineIndex::Insert(const FInterval& Interval)
+{
+    ByStart.Insert(Interval, Algo::LowerBound(ByStart, Interval, StartLess));
+    ByEnd.Insert(Interval, Algo::LowerBound(ByEnd, Interval, EndLess));
+    bTreeDirty = true;
+}
+
+void FGitHubTimelineIndex::Remove(const FInterval& Interval)
+{
+    const int32 StartIndex = Algo::BinarySearch(ByStart, Interval, StartLess);
+    if (StartIndex != INDEX_NONE)
+    {
+        ByStart.RemoveAt(StartIndex, 1, EAllowShrinking::No);
+    }
+
+    const int32 EndIndex = Algo::BinarySearch(ByEnd, Interval, EndLess);
+    if (EndIndex != INDEX_NONE)
+    {
+        ByEnd.RemoveAt(EndIndex, 1, EAllowShrinking::No);
+    }
+
+    bTreeDirty = true;
+}
+
+bool FGitHubTimelineIndex::Replace(const FInterval& Previous, const FInterval& Interval)
+{
+    const int32 StartIndex = Algo::BinarySearch(ByStart, Previous, StartLess);
+    const int32 EndIndex = Algo::BinarySearch(ByEnd, Previous, EndLess);
+    if (StartIndex == INDEX_NONE || EndIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // The tree is shaped by the positions in ByStart, it only holds while the interval stays between its neighbours
+    if ((StartIndex > 0 && !StartLess(ByStart[StartIndex - 1], Interval)) || (StartIndex + 1 < ByStart.Num() && !StartLess(Interval, ByStart[StartIndex + 1])))
+    {
+        return false;
+    }
+
+    ByStart[StartIndex] = Interval;
+    ByEnd.RemoveAt(EndIndex, 1, EAllowShrinking::No);
+    ByEnd.Insert(Interval, Algo::LowerBound(ByEnd, Interval, EndLess));
+
+    if (!bTreeDirty && SubtreeMaxEnd.Num() == ByStart.Num())
+    {
+        UpdatePath(0, ByStart.Num(), StartIndex);
+    }
+    return true;
+}
+
+void FGitHubTimelineIndex::EnsureTreeBuilt() const
+{
+    if (!bTreeDirty && SubtreeMaxEnd.Num() == ByStart.Num())
+    {
+        return;
+    }
+
+    SubtreeMaxEnd.SetNumUninitialized(ByStart.Num(), EAllowShrinking::No);
+    BuildSubtree(0, ByStart.Num());
+    bTreeDirty = false;
+}
+
+FDateTime FGitHubTimelineIndex::BuildSubtree(int32 First, int32 Last) const
+{
+    if (First >= Last)
+    {
+        return FDateTime::MinValue();
+    }
+
+    const int32 Middle = First + (Last - First) / 2;
+    FDateTime MaxEnd = ByStart[Middle].End;
+    MaxEnd = FMath::Max(MaxEnd, BuildSubtree(First, Middle));
+    MaxEnd = FMath::Max(MaxEnd, BuildSubtree(Middle + 1, Last));
+    SubtreeMaxEnd[Middle] = MaxEnd;
+    return MaxEnd;
+}
+
+void FGitHubTimelineIndex::UpdatePath(int32 First, int32 Last, int32 Index)
+{
+    // Walks down to the node of Index and recomputes every maximum above it on the way back up
+    const int32 Middle = First + (Last - First) / 2;
+    if (Index < Middle)
+    {
+        UpdatePath(First, Middle, Index);
+    }
+    else if (Index > Middle)
+    {
+        UpdatePath(Middle + 1, Last, Index);
+    }
+
+    FDateTime MaxEnd = ByStart[Middle].End;
+    if (First < Middle)
+    {
+        MaxEnd = FMath::Max(MaxEnd, SubtreeMaxEnd[First + (Middle - First) / 2]);
+    }
+    if (Middle + 1 < Last)
+    {
+        MaxEnd = FMath::Max(MaxEnd, SubtreeMaxEnd[Middle + 1 + (Last - Middle - 1) / 2]);
+    }
+    SubtreeMaxEnd[Middle] = MaxEnd;
+}
+
+void FGitHubTimelineIndex::CollectOverlapping(int32 First, int32 Last, const FDateTime& From, const FDateTime& To, TArray<FString>& OutItemIds) const
+{
+    if (First >= Last)
+    {
+        return;
+    }
+
+    const int32 Middle = First + (Last - First) / 2;
+
+    // Nothing below this node ends late enough to reach the range
+    if (SubtreeMaxEnd[Middle] < From)
+    {
+        return;
+    }
+
+    CollectOverlapping(First, Middle, From, To, OutItemIds);
+
+    // Everything from here on starts after the range
+    const FInterval& Interval = ByStart[Middle];
+    if (Interval.Start > To)
+    {
+        return;
+    }
+
+    if (Interval.End >= From)
+    {
+        OutItemIds.Add(Interval.ItemId);
+    }
+
+    CollectOverlapping(Middle + 1, Last, From, To, OutItemIds);
+}
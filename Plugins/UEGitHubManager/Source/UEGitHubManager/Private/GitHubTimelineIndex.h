@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FProjectItem;
+
+/**
+ * Interval index over the StartDate/EndDate of one project's items.
+ *
+ * Intervals are kept sorted by start and form an implicit balanced tree (the middle element of every
+ * range is its root) augmented with the largest end date below each node, so overlap queries prune
+ * whole subtrees. A second array sorted by end date answers "next due" queries.
+ * A date edit that keeps the item's place among the starts, like dragging a bar's end, only updates the
+ * maxima on the path to its node. Inserts and removals shift the tree, it is rebuilt once before the next
+ * overlap query.
+ * Items with only one date are indexed as a single day, items without dates are not indexed.
+ * Game thread only.
+ */
+class FGitHubTimelineIndex
+{
+public:
+	void UpdateItem(const FProjectItem& Item);
+	void RemoveItem(const FString& ItemId);
+
+	// Indexes Items and drops every indexed item that is not part of it
+	void SyncItems(const TArray<FProjectItem>& Items);
+
+	// Items whose interval intersects [From, To], ordered by start
+	TArray<FString> QueryOverlapping(const FDateTime& From, const FDateTime& To) const;
+
+	// Items whose interval lies completely inside [From, To], ordered by start
+	TArray<FString> QueryContained(const FDateTime& From, const FDateTime& To) const;
+
+	// The next Count items whose end date is at or after After, soonest first
+	TArray<FString> QueryNextDue(const FDateTime& After, int32 Count) const;
+
+	int32 Num() const { return ByStart.Num(); }
+
+	// Heap memory held by the index, for the board cache budget
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FInterval
+	{
+		FString ItemId;
+		FDateTime Start;
+		FDateTime End;
+	};
+
+	static bool StartLess(const FInterval& A, const FInterval& B);
+	static bool EndLess(const FInterval& A, const FInterval& B);
+
+	// False for items without any date
+	static bool MakeInterval(const FProjectItem& Item, FInterval& OutInterval);
+
+	void Insert(const FInterval& Interval);
+	void Remove(const FInterval& Interval);
+
+	// Replaces the interval in place, false if the new one sorts elsewhere among the starts
+	bool Replace(const FInterval& Previous, const FInterval& Interval);
+
+	void EnsureTreeBuilt() const;
+	FDateTime BuildSubtree(int32 First, int32 Last) const;
+	void UpdatePath(int32 First, int32 Last, int32 Index);
+	void CollectOverlapping(int32 First, int32 Last, const FDateTime& From, const FDateTime& To, TArray<FString>& OutItemIds) const;
+
+	TArray<FInterval> ByStart;
+	TArray<FInterval> ByEnd;
+	TMap<FString, FInterval> IntervalByItemId;
+
+	// Largest end date of the implicit subtree rooted at each ByStart index, rebuilt lazily after inserts and removals
+	mutable TArray<FDateTime> SubtreeMaxEnd;
+	mutable bool bTreeDirty = false;
+};
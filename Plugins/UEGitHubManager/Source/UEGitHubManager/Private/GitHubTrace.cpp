@@ -0,0 +1,64 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubTrace.h"
+#include <atomic>
+
+UE_TRACE_CHANNEL_DEFINE(GitHubSyncChannel);
+
+namespace
+{
+    std::atomic<uint64> NextFlowId{ 1 };
+    thread_local FGitHubTraceFlowPtr CurrentFlow;
+}
+
+FGitHubTraceFlow::FGitHubTraceFlow(const TCHAR* InLabel)
+    : Id(NextFlowId.fetch_add(1, std::memory_order_relaxed))
+    , Label(InLabel)
+{
+    if (UE_TRACE_CHANNELEXPR_IS_ENABLED(GitHubSyncChannel))
+    {
+        RegionName = FString::Printf(TEXT("GitHub #%llu %s"), Id, Label);
+        TRACE_BEGIN_REGION(*RegionName);
+    }
+}
+
+FGitHubTraceFlow::~FGitHubTraceFlow()
+{
+    // Only close regions that were opened, the channel may have been toggled in between
+    if (!RegionName.IsEmpty())
+    {
+        TRACE_END_REGION(*RegionName);
+    }
+}
+
+void FGitHubTraceFlow::MarkStage(const TCHAR* Stage) const
+{
+    if (UE_TRACE_CHANNELEXPR_IS_ENABLED(GitHubSyncChannel))
+    {
+        TRACE_BOOKMARK(TEXT("GitHub #%llu %s: %s"), Id, Label, Stage);
+    }
+}
+
+FGitHubTraceFlowPtr GitHubTrace::BeginFlow(const TCHAR* Label)
+{
+    FGitHubTraceFlowPtr Flow = MakeShared<FGitHubTraceFlow, ESPMode::ThreadSafe>(Label);
+    Flow->MarkStage(TEXT("Start"));
+    return Flow;
+}
+
+FGitHubTraceFlowPtr GitHubTrace::GetCurrentFlow()
+{
+    return CurrentFlow;
+}
+
+GitHubTrace::FFlowScope::FFlowScope(const FGitHubTraceFlowPtr& Flow)
+    : PreviousFlow(CurrentFlow)
+{
+    CurrentFlow = Flow;
+}
+
+GitHubTrace::FFlowScope::~FFlowScope()
+{
+    CurrentFlow = PreviousFlow;
+}
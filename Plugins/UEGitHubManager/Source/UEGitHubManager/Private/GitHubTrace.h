@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+/**
+ * Unreal Insights instrumentation for the GitHub sync pipeline.
+ * Enable with -trace=cpu,region,bookmark,GitHubSync (or "Trace.Enable GitHubSync" at runtime).
+ */
+UE_TRACE_CHANNEL_EXTERN(GitHubSyncChannel);
+
+/** CPU scope that only records while the GitHubSync channel is enabled. */
+#define GITHUB_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, GitHubSyncChannel)
+
+/**
+ * One request's journey from ProcessRequest to the game thread broadcast.
+ * Shown as a timing region named "GitHub #<Id> <Label>"; each stage drops a bookmark with the same prefix.
+ * The region ends when the last holder (usually the game thread broadcast task) releases the flow.
+ */
+class FGitHubTraceFlow
+{
+public:
+	explicit FGitHubTraceFlow(const TCHAR* InLabel);
+	~FGitHubTraceFlow();
+
+	void MarkStage(const TCHAR* Stage) const;
+
+	uint64 GetId() const { return Id; }
+
+private:
+	uint64 Id;
+	const TCHAR* Label;
+	FString RegionName;
+};
+
+using FGitHubTraceFlowPtr = TSharedPtr<FGitHubTraceFlow, ESPMode::ThreadSafe>;
+
+namespace GitHubTrace
+{
+	/** Starts a new flow. Label must be a string literal. */
+	FGitHubTraceFlowPtr BeginFlow(const TCHAR* Label);
+
+	/** Flow of the response currently being processed on this thread, if any. */
+	FGitHubTraceFlowPtr GetCurrentFlow();
+
+	/** Makes a flow current for the handlers invoked inside this scope. */
+	class FFlowScope
+	{
+	public:
+		explicit FFlowScope(const FGitHubTraceFlowPtr& Flow);
+		~FFlowScope();
+
+	private:
+		FGitHubTraceFlowPtr PreviousFlow;
+	};
+}
@@ -0,0 +1,150 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "GitHubUsageHistory.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+    constexpr int32 HistoryVersion = 1;
+
+    // Projects beyond this are forgotten, lowest score first
+    constexpr int32 MaxRememberedProjects = 200;
+}
+
+FGitHubUsageHistory::FGitHubUsageHistory(const FString& InHistoryPath)
+    : HistoryPath(InHistoryPath)
+{
+}
+
+void FGitHubUsageHistory::Load()
+{
+    UsageByProject.Reset();
+
+    FString HistoryText;
+    if (!FFileHelper::LoadFileToString(HistoryText, *HistoryPath))
+    {
+        return;
+    }
+
+    TSharedPtr<FJsonObject> HistoryObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HistoryText);
+    const TArray<TSharedPtr<FJsonValue>>* ProjectValues;
+    if (!FJsonSerializer::Deserialize(Reader, HistoryObject) || !HistoryObject.IsValid() || !HistoryObject->TryGetArrayField(TEXT("projects"), ProjectValues))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Usage history %s could not be read, prefetching starts from scratch."), *HistoryPath);
+        return;
+    }
+
+    for (const TSharedPtr<FJsonValue>& Value : *ProjectValues)
+    {
+        const TSharedPtr<FJsonObject>* ProjectObject;
+        if (!Value->TryGetObject(ProjectObject))
+        {
+            continue;
+        }
+
+        FString ProjectId;
+        FString LastOpened;
+        FUsage Usage;
+        if ((*ProjectObject)->TryGetStringField(TEXT("projectId"), ProjectId)
+            && (*ProjectObject)->TryGetNumberField(TEXT("score"), Usage.Score)
+            && (*ProjectObject)->TryGetStringField(TEXT("lastOpened"), LastOpened)
+            && FDateTime::ParseIso8601(*LastOpened, Usage.LastOpened))
+        {
+            UsageByProject.Add(ProjectId, Usage);
+        }
+    }
+}
+
+void FGitHubUsageHistory::RecordOpen(const FString& ProjectId, const FDateTime& Now, float HalfLifeDays)
+{
+    FUsage& Usage = UsageByProject.FindOrAdd(ProjectId);
+    Usage.Score = DecayedScore(Usage, Now, HalfLifeDays) + 1.0;
+    Usage.LastOpened = Now;
+
+    if (UsageByProject.Num() > MaxRememberedProjects)
+    {
+        UsageByProject.ValueSort([&Now, HalfLifeDays](const FUsage& A, const FUsage& B)
+            {
+                return DecayedScore(A, Now, HalfLifeDays) > DecayedScore(B, Now, HalfLifeDays);
+            });
+
+        TMap<FString, FUsage> Kept;
+        for (const TPair<FString, FUsage>& Entry : UsageByProject)
+        {
+            if (Kept.Num() == MaxRememberedProjects)
+            {
+                break;
+            }
+            Kept.Add(Entry.Key, Entry.Value);
+        }
+        UsageByProject = MoveTemp(Kept);
+    }
+
+    Save();
+}
+
+TArray<FString> FGitHubUsageHistory::Rank(const TArray<FString>& Candidates, int32 MaxCount, const FDateTime& Now, float HalfLifeDays) const
+{
+    TArray<TPair<double, FString>> Scored;
+    for (const FString& ProjectId : Candidates)
+    {
+        if (const FUsage* Usage = UsageByProject.Find(ProjectId))
+        {
+            Scored.Emplace(DecayedScore(*Usage, Now, HalfLifeDays), ProjectId);
+        }
+    }
+
+    Scored.Sort([](const TPair<double, FString>& A, const TPair<double, FString>& B) { return A.Key > B.Key; });
+
+    TArray<FString> Result;
+    for (int32 Index = 0; Index < Scored.Num() && Result.Num() < MaxCount; ++Index)
+    {
+        Result.Add(Scored[Index].Value);
+    }
+    return Result;
+}
+
+double FGitHubUsageHistory::DecayedScore(const FUsage& Usage, const FDateTime& Now, float HalfLifeDays)
+{
+    if (Usage.Score <= 0.0 || HalfLifeDays <= 0.0f)
+    {
+        return Usage.Score;
+    }
+
+    const double ElapsedDays = FMath::Max(0.0, (Now - Usage.LastOpened).GetTotalDays());
+    return Usage.Score * FMath::Pow(0.5, ElapsedDays / HalfLifeDays);
+}
+
+void FGitHubUsageHistory::Save() const
+{
+    TArray<TSharedPtr<FJsonValue>> ProjectValues;
+    ProjectValues.Reserve(UsageByProject.Num());
+    for (const TPair<FString, FUsage>& Entry : UsageByProject)
+    {
+        TSharedRef<FJsonObject> ProjectObject = MakeShared<FJsonObject>();
+        ProjectObject->SetStringField(TEXT("projectId"), Entry.Key);
+        ProjectObject->SetNumberField(TEXT("score"), Entry.Value.Score);
+        ProjectObject->SetStringField(TEXT("lastOpened"), Entry.Value.LastOpened.ToIso8601());
+        ProjectValues.Add(MakeShared<FJsonValueObject>(ProjectObject));
+    }
+
+    TSharedRef<FJsonObject> HistoryObject = MakeShared<FJsonObject>();
+    HistoryObject->SetNumberField(TEXT("version"), HistoryVersion);
+    HistoryObject->SetArrayField(TEXT("projects"), ProjectValues);
+
+    FString HistoryText;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&HistoryText);
+    FJsonSerializer::Serialize(HistoryObject, Writer);
+
+    const FString TempPath = HistoryPath + TEXT(".tmp");
+    if (!FFileHelper::SaveStringToFile(HistoryText, *TempPath) || !IFileManager::Get().Move(*HistoryPath, *TempPath, true, true))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Usage history %s could not be written."), *HistoryPath);
+    }
+}
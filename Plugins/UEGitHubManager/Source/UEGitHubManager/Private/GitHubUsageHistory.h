@@ -0,0 +1,39 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Persisted record of the projects the user opens, ranked by how recently and how often they were opened.
+ *
+ * Each open adds one to a score that halves every half-life, so a project opened every day last week and
+ * one opened once an hour ago both rank high while projects not touched in months fade out. The history
+ * is rewritten on every open. Game thread only.
+ */
+class FGitHubUsageHistory
+{
+public:
+	explicit FGitHubUsageHistory(const FString& InHistoryPath);
+
+	void Load();
+
+	void RecordOpen(const FString& ProjectId, const FDateTime& Now, float HalfLifeDays);
+
+	// Up to MaxCount of Candidates, the most likely next one first. Projects never opened are left out.
+	TArray<FString> Rank(const TArray<FString>& Candidates, int32 MaxCount, const FDateTime& Now, float HalfLifeDays) const;
+
+private:
+	struct FUsage
+	{
+		// Score as of LastOpened
+		double Score = 0.0;
+		FDateTime LastOpened;
+	};
+
+	static double DecayedScore(const FUsage& Usage, const FDateTime& Now, float HalfLifeDays);
+	void Save() const;
+
+	FString HistoryPath;
+	TMap<FString, FUsage> UsageByProject;
+};
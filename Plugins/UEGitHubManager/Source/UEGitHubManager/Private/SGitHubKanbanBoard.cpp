@@ -0,0 +1,392 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SGitHubKanbanBoard.h"
+#include "GitHubTrace.h"
+#include "DragAndDrop/DecoratedDragDropOp.h"
+#include "Styling/AppStyle.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "GitHubKanbanBoard"
+
+namespace
+{
+    constexpr float ColumnWidth = 260.0f;
+}
+
+DECLARE_DELEGATE_TwoParams(FOnGitHubCardDropped, const FString& /*ItemId*/, const FString& /*ColumnId*/);
+
+/** Card being dragged between columns */
+class FGitHubCardDragDropOp : public FDecoratedDragDropOp
+{
+public:
+    DRAG_DROP_OPERATOR_TYPE(FGitHubCardDragDropOp, FDecoratedDragDropOp)
+
+    FString ItemId;
+    FString FromColumnId;
+
+    static TSharedRef<FGitHubCardDragDropOp> New(const FProjectItem& Item)
+    {
+        TSharedRef<FGitHubCardDragDropOp> Operation = MakeShareable(new FGitHubCardDragDropOp);
+        Operation->ItemId = Item.ItemId;
+        Operation->FromColumnId = Item.ColumnId;
+        Operation->DefaultHoverText = FText::FromString(Item.Title);
+        Operation->CurrentHoverText = Operation->DefaultHoverText;
+        Operation->Construct();
+        return Operation;
+    }
+};
+
+/** One column: a header with the card count and a virtualized list of its cards */
+class SGitHubKanbanColumn : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SGitHubKanbanColumn) {}
+        SLATE_ARGUMENT(FString, ColumnId)
+        SLATE_ARGUMENT(FText, ColumnName)
+        SLATE_EVENT(FOnGitHubCardDropped, OnCardDropped)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs)
+    {
+        ColumnId = InArgs._ColumnId;
+        OnCardDropped = InArgs._OnCardDropped;
+
+        ChildSlot
+        [
+            SNew(SBox)
+            .WidthOverride(ColumnWidth)
+            [
+                SNew(SBorder)
+                .BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
+                .BorderBackgroundColor_Lambda([this]() { return bIsDropTarget ? FAppStyle::GetSlateColor("SelectionColor") : FSlateColor(FLinearColor::White); })
+                .Padding(4.0f)
+                [
+                    SNew(SVerticalBox)
+                    + SVerticalBox::Slot()
+                    .AutoHeight()
+                    .Padding(2.0f, 2.0f, 2.0f, 6.0f)
+                    [
+                        SNew(STextBlock)
+                        .Font(FAppStyle::GetFontStyle("BoldFont"))
+                        .Text_Lambda([this, ColumnName = InArgs._ColumnName]()
+                            {
+                                return FText::Format(LOCTEXT("ColumnHeader", "{0} ({1})"), ColumnName, FText::AsNumber(Cards.Num()));
+                            })
+                    ]
+                    + SVerticalBox::Slot()
+                    .FillHeight(1.0f)
+                    [
+                        SAssignNew(ListView, SListView<TSharedPtr<FProjectItem>>)
+                        .ListItemsSource(&Cards)
+                        .SelectionMode(ESelectionMode::Single)
+                        .OnGenerateRow(this, &SGitHubKanbanColumn::OnGenerateCard)
+                    ]
+                ]
+            ]
+        ];
+    }
+
+    const FString& GetColumnId() const { return ColumnId; }
+
+    // Only refreshes the list if a card was added, removed, replaced or reordered
+    void SetCards(TArray<TSharedPtr<FProjectItem>>&& NewCards)
+    {
+        if (NewCards == Cards)
+        {
+            return;
+        }
+
+        Cards = MoveTemp(NewCards);
+        ListView->RequestListRefresh();
+    }
+
+    virtual void OnDragEnter(const FGeometry& MyGeometry, const FDragDropEvent& DragDropEvent) override
+    {
+        bIsDropTarget = CanAccept(DragDropEvent);
+    }
+
+    virtual void OnDragLeave(const FDragDropEvent& DragDropEvent) override
+    {
+        bIsDropTarget = false;
+    }
+
+    virtual FReply OnDragOver(const FGeometry& MyGeometry, const FDragDropEvent& DragDropEvent) override
+    {
+        return CanAccept(DragDropEvent) ? FReply::Handled() : FReply::Unhandled();
+    }
+
+    virtual FReply OnDrop(const FGeometry& MyGeometry, const FDragDropEvent& DragDropEvent) override
+    {
+        bIsDropTarget = false;
+        if (!CanAccept(DragDropEvent))
+        {
+            return FReply::Unhandled();
+        }
+
+        OnCardDropped.ExecuteIfBound(DragDropEvent.GetOperationAs<FGitHubCardDragDropOp>()->ItemId, ColumnId);
+        return FReply::Handled();
+    }
+
+private:
+    bool CanAccept(const FDragDropEvent& DragDropEvent) const
+    {
+        // Items without a status can only be moved out of that column, never into it
+        TSharedPtr<FGitHubCardDragDropOp> Operation = DragDropEvent.GetOperationAs<FGitHubCardDragDropOp>();
+        return Operation.IsValid() && !ColumnId.IsEmpty() && Operation->FromColumnId != ColumnId;
+    }
+
+    TSharedRef<ITableRow> OnGenerateCard(TSharedPtr<FProjectItem> Card, const TSharedRef<STableViewBase>& OwnerTable)
+    {
+        FString Details = Card->Type;
+        if (!Card->StartDate.IsEmpty() || !Card->EndDate.IsEmpty())
+        {
+            Details += FString::Printf(TEXT("  %s - %s"), *Card->StartDate.Left(10), *Card->EndDate.Left(10));
+        }
+
+        return SNew(STableRow<TSharedPtr<FProjectItem>>, OwnerTable)
+            .Padding(FMargin(0.0f, 2.0f))
+            .OnDragDetected_Lambda([Card](const FGeometry&, const FPointerEvent&)
+                {
+                    return FReply::Handled().BeginDragDrop(FGitHubCardDragDropOp::New(*Card));
+                })
+            [
+                SNew(SBorder)
+                .BorderImage(FAppStyle::GetBrush("ToolPanel.DarkGroupBorder"))
+                .Padding(6.0f)
+                .ToolTipText(FText::FromString(Card->Title))
+                [
+                    SNew(SVerticalBox)
+                    + SVerticalBox::Slot()
+                    .AutoHeight()
+                    [
+                        SNew(STextBlock)
+                        .Text(FText::FromString(Card->Title))
+                        .OverflowPolicy(ETextOverflowPolicy::Ellipsis)
+                    ]
+                    + SVerticalBox::Slot()
+                    .AutoHeight()
+                    [
+                        SNew(STextBlock)
+                        .Text(FText::FromString(Details))
+                        .Font(FAppStyle::GetFontStyle("SmallFont"))
+                        .ColorAndOpacity(FSlateColor::UseSubduedForeground())
+                        .OverflowPolicy(ETextOverflowPolicy::Ellipsis)
+                    ]
+                ]
+            ];
+    }
+
+    FString ColumnId;
+    FOnGitHubCardDropped OnCardDropped;
+    TArray<TSharedPtr<FProjectItem>> Cards;
+    TSharedPtr<SListView<TSharedPtr<FProjectItem>>> ListView;
+    bool bIsDropTarget = false;
+};
+
+void SGitHubKanbanBoard::Construct(const FArguments& InArgs)
+{
+    ChildSlot
+    [
+        SNew(SVerticalBox)
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(4.0f)
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot()
+            .FillWidth(1.0f)
+            [
+                SAssignNew(ProjectCombo, SComboBox<TSharedPtr<FProjectInfo>>)
+                .OptionsSource(&ProjectOptions)
+                .OnGenerateWidget(this, &SGitHubKanbanBoard::MakeProjectOption)
+                .OnSelectionChanged(this, &SGitHubKanbanBoard::OnProjectSelected)
+                [
+                    SNew(STextBlock)
+                    .Text(this, &SGitHubKanbanBoard::GetSelectedProjectText)
+                ]
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(4.0f, 0.0f, 0.0f, 0.0f)
+            [
+                SNew(SButton)
+                .Text(LOCTEXT("LoadProjects", "Load Projects"))
+                .OnClicked(this, &SGitHubKanbanBoard::OnLoadProjectsClicked)
+            ]
+        ]
+        + SVerticalBox::Slot()
+        .FillHeight(1.0f)
+        [
+            SNew(SScrollBox)
+            .Orientation(Orient_Horizontal)
+            + SScrollBox::Slot()
+            [
+                SAssignNew(ColumnBox, SHorizontalBox)
+            ]
+        ]
+    ];
+
+    RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateSP(this, &SGitHubKanbanBoard::Poll));
+}
+
+EActiveTimerReturnType SGitHubKanbanBoard::Poll(double InCurrentTime, float InDeltaTime)
+{
+    UGitHubAPIManager* Manager = UGitHubAPIManager::GetInstance();
+
+    // Snapshots are immutable, comparing pointers is all it takes to know nothing changed
+    const FGitHubProjectListHandle Projects = Manager->GetProjectListHandle();
+    if (Projects.Snapshot != SeenProjects)
+    {
+        SeenProjects = Projects.Snapshot;
+        SyncProjects(Projects);
+    }
+
+    if (!ProjectId.IsEmpty())
+    {
+        const FGitHubBoardHandle Board = Manager->GetBoardHandle(ProjectId);
+        if (Board.Snapshot != SeenBoard)
+        {
+            SeenBoard = Board.Snapshot;
+            if (Board.IsValid())
+            {
+                SyncBoard(*Board.Get());
+            }
+        }
+    }
+
+    return EActiveTimerReturnType::Continue;
+}
+
+void SGitHubKanbanBoard::SyncProjects(const FGitHubProjectListHandle& Projects)
+{
+    ProjectOptions.Reset();
+    if (Projects.IsValid())
+    {
+        for (const FProjectInfo& Project : *Projects.Get())
+        {
+            ProjectOptions.Add(MakeShared<FProjectInfo>(Project));
+        }
+    }
+    ProjectCombo->RefreshOptions();
+}
+
+void SGitHubKanbanBoard::SyncBoard(const FProjectInfo& Board)
+{
+    GITHUB_TRACE_SCOPE(GitHub_SyncKanbanBoard);
+
+    ColumnFieldId = Board.ColumnFieldId;
+
+    // Items without a known status get a column of their own at the front
+    TArray<FString> NewColumnIds;
+    TSet<FString> KnownColumnIds;
+    for (const FColumnInfo& Column : Board.Columns)
+    {
+        NewColumnIds.Add(Column.ColumnId);
+        KnownColumnIds.Add(Column.ColumnId);
+    }
+    if (Board.Items.ContainsByPredicate([&KnownColumnIds](const FProjectItem& Item) { return !KnownColumnIds.Contains(Item.ColumnId); }))
+    {
+        NewColumnIds.Insert(FString(), 0);
+    }
+
+    if (NewColumnIds != ColumnIds)
+    {
+        ColumnIds = NewColumnIds;
+        RebuildColumns(Board, ColumnIds);
+    }
+
+    TMap<FString, TArray<TSharedPtr<FProjectItem>>> CardsByColumn;
+    TMap<FString, TSharedPtr<FProjectItem>> NextCards;
+    NextCards.Reserve(Board.Items.Num());
+    for (const FProjectItem& Item : Board.Items)
+    {
+        const TSharedPtr<FProjectItem>* Existing = CardsById.Find(Item.ItemId);
+        const bool bUnchanged = Existing && (*Existing)->ContentHash == Item.ContentHash && (*Existing)->ColumnId == Item.ColumnId;
+        TSharedPtr<FProjectItem> Card = bUnchanged ? *Existing : MakeShared<FProjectItem>(Item);
+
+        NextCards.Add(Item.ItemId, Card);
+        CardsByColumn.FindOrAdd(KnownColumnIds.Contains(Item.ColumnId) ? Item.ColumnId : FString()).Add(Card);
+    }
+    CardsById = MoveTemp(NextCards);
+
+    for (const TSharedPtr<SGitHubKanbanColumn>& Column : Columns)
+    {
+        TArray<TSharedPtr<FProjectItem>>* ColumnCards = CardsByColumn.Find(Column->GetColumnId());
+        Column->SetCards(ColumnCards ? MoveTemp(*ColumnCards) : TArray<TSharedPtr<FProjectItem>>());
+    }
+}
+
+void SGitHubKanbanBoard::RebuildColumns(const FProjectInfo& Board, const TArray<FString>& NewColumnIds)
+{
+    ColumnBox->ClearChildren();
+    Columns.Reset();
+
+    for (const FString& ColumnId : NewColumnIds)
+    {
+        const FColumnInfo* Info = Board.Columns.FindByPredicate([&ColumnId](const FColumnInfo& Candidate) { return Candidate.ColumnId == ColumnId; });
+
+        TSharedPtr<SGitHubKanbanColumn> Column;
+        ColumnBox->AddSlot()
+            .AutoWidth()
+            .Padding(2.0f)
+            [
+                SAssignNew(Column, SGitHubKanbanColumn)
+                .ColumnId(ColumnId)
+                .ColumnName(Info ? FText::FromString(Info->ColumnName) : LOCTEXT("NoStatus", "No Status"))
+                .OnCardDropped(this, &SGitHubKanbanBoard::OnCardDropped)
+            ];
+        Columns.Add(Column);
+    }
+}
+
+TSharedRef<SWidget> SGitHubKanbanBoard::MakeProjectOption(TSharedPtr<FProjectInfo> Project) const
+{
+    return SNew(STextBlock).Text(FText::FromString(Project->ProjectTitle));
+}
+
+void SGitHubKanbanBoard::OnProjectSelected(TSharedPtr<FProjectInfo> Project, ESelectInfo::Type SelectInfo)
+{
+    if (!Project.IsValid() || Project->ProjectId == ProjectId)
+    {
+        return;
+    }
+
+    ProjectId = Project->ProjectId;
+    ProjectTitle = Project->ProjectTitle;
+
+    SeenBoard.Reset();
+    CardsById.Reset();
+    ColumnIds.Reset();
+    Columns.Reset();
+    ColumnBox->ClearChildren();
+
+    // A board that is already loaded shows up on the next poll, the fetch then only reports what changed
+    UGitHubAPIManager::GetInstance()->FetchProjectDetailsAsync(ProjectId);
+}
+
+FText SGitHubKanbanBoard::GetSelectedProjectText() const
+{
+    return ProjectTitle.IsEmpty() ? LOCTEXT("SelectProject", "Select a project") : FText::FromString(ProjectTitle);
+}
+
+FReply SGitHubKanbanBoard::OnLoadProjectsClicked()
+{
+    UGitHubAPIManager::GetInstance()->FetchUserProjects();
+    return FReply::Handled();
+}
+
+void SGitHubKanbanBoard::OnCardDropped(const FString& ItemId, const FString& ColumnId)
+{
+    // The manager updates its board right away, the next poll moves the card
+    UGitHubAPIManager::GetInstance()->MoveProjectItem(ProjectId, ItemId, ColumnId, ColumnFieldId);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,59 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Input/SComboBox.h"
+#include "UGitHubAPIManager.h"
+
+class SHorizontalBox;
+class SGitHubKanbanColumn;
+
+/**
+ * Native Kanban view of one project, hosted by the editor mode toolkit.
+ *
+ * Reads the board snapshot straight from UGitHubAPIManager and checks once per frame whether it was replaced.
+ * A new snapshot only swaps the cards whose content or column changed, and every column is an SListView that
+ * realizes just the rows on screen. Dropping a card on another column moves it through MoveProjectItem.
+ */
+class SGitHubKanbanBoard : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGitHubKanbanBoard) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	// Project shown on the board, empty until one is selected
+	FString GetProjectId() const { return ProjectId; }
+
+private:
+	EActiveTimerReturnType Poll(double InCurrentTime, float InDeltaTime);
+	void SyncProjects(const FGitHubProjectListHandle& Projects);
+	void SyncBoard(const FProjectInfo& Board);
+	void RebuildColumns(const FProjectInfo& Board, const TArray<FString>& ColumnIds);
+
+	TSharedRef<SWidget> MakeProjectOption(TSharedPtr<FProjectInfo> Project) const;
+	void OnProjectSelected(TSharedPtr<FProjectInfo> Project, ESelectInfo::Type SelectInfo);
+	FText GetSelectedProjectText() const;
+	FReply OnLoadProjectsClicked();
+	void OnCardDropped(const FString& ItemId, const FString& ColumnId);
+
+	TArray<TSharedPtr<FProjectInfo>> ProjectOptions;
+	TSharedPtr<SComboBox<TSharedPtr<FProjectInfo>>> ProjectCombo;
+	FString ProjectId;
+	FString ProjectTitle;
+	FString ColumnFieldId;
+
+	// Last snapshots seen, a different pointer means the manager published a change
+	TSharedPtr<const TArray<FProjectInfo>, ESPMode::ThreadSafe> SeenProjects;
+	TSharedPtr<const FProjectInfo, ESPMode::ThreadSafe> SeenBoard;
+
+	// One card per item, kept while the item is unchanged so its row widget is reused
+	TMap<FString, TSharedPtr<FProjectItem>> CardsById;
+
+	TArray<FString> ColumnIds;
+	TArray<TSharedPtr<SGitHubKanbanColumn>> Columns;
+	TSharedPtr<SHorizontalBox> ColumnBox;
+};
@@ -0,0 +1,557 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "SGitHubTimeline.h"
+#include "GitHubTrace.h"
+#include "Algo/BinarySearch.h"
+#include "Styling/AppStyle.h"
+
+namespace
+{
+    constexpr float HeaderHeight = 22.0f;
+    constexpr float MinLaneHeight = 1.0f;
+    constexpr float MaxLaneHeight = 32.0f;
+    // Rows thinner than this merge several lanes into one
+    constexpr float MinRowHeight = 6.0f;
+    constexpr double MinPixelsPerDay = 0.01;
+    constexpr double MaxPixelsPerDay = 200.0;
+    // Bars closer than this are painted as one aggregate
+    constexpr double MergeGapPixels = 2.0;
+    // Bars narrower than this can not be grabbed
+    constexpr double MinEditablePixels = 6.0;
+    constexpr double EdgeGrabPixels = 4.0;
+
+    bool IsDateSet(const FDateTime& Date)
+    {
+        return Date.GetTicks() > 0;
+    }
+
+    double ToDays(const FDateTime& Date)
+    {
+        return double(Date.GetTicks() / ETimespan::TicksPerDay);
+    }
+
+    FDateTime FromDays(double Day)
+    {
+        return FDateTime(int64(FMath::FloorToDouble(Day)) * ETimespan::TicksPerDay);
+    }
+
+    FLinearColor GetColumnColor(const FString& ColumnId)
+    {
+        if (ColumnId.IsEmpty())
+        {
+            return FLinearColor(0.35f, 0.35f, 0.35f);
+        }
+        return FLinearColor::MakeFromHSV8(uint8(GetTypeHash(ColumnId) & 0xFF), 130, 200);
+    }
+
+    // Horizontal extent of one or more bars painted as one box
+    struct FSpan
+    {
+        double X0;
+        double X1;
+        int32 BarIndex;
+    };
+
+    struct FLaneEnd
+    {
+        double End;
+        int32 Lane;
+
+        bool operator<(const FLaneEnd& Other) const { return End < Other.End; }
+    };
+}
+
+void SGitHubTimeline::Construct(const FArguments& InArgs)
+{
+    ProjectId = InArgs._ProjectId;
+    SetClipping(EWidgetClipping::ClipToBounds);
+}
+
+void SGitHubTimeline::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+    ViewHeight = AllottedGeometry.GetLocalSize().Y;
+
+    const FString CurrentProjectId = ProjectId.Get();
+    if (CurrentProjectId != SyncedProjectId)
+    {
+        SyncedProjectId = CurrentProjectId;
+        SeenBoard.Reset();
+        Bars.Reset();
+        Lanes.Reset();
+        DragMode = EDragMode::None;
+        bFitPending = true;
+    }
+
+    // Snapshots are immutable, a new pointer is the only thing worth relaying out for
+    if (!SyncedProjectId.IsEmpty() && DragMode == EDragMode::None)
+    {
+        const FGitHubBoardHandle Board = UGitHubAPIManager::GetInstance()->GetBoardHandle(SyncedProjectId);
+        if (Board.Snapshot != SeenBoard)
+        {
+            SeenBoard = Board.Snapshot;
+            if (Board.IsValid())
+            {
+                SyncBoard(*Board.Get());
+            }
+        }
+    }
+
+    if (bFitPending && Bars.Num() > 0)
+    {
+        FitToBars(AllottedGeometry.GetLocalSize().X);
+        bFitPending = false;
+    }
+}
+
+void SGitHubTimeline::SyncBoard(const FProjectInfo& Board)
+{
+    GITHUB_TRACE_SCOPE(GitHub_LayoutTimeline);
+
+    StartDateFieldId = Board.StartDateFieldId;
+    EndDateFieldId = Board.EndDateFieldId;
+
+    Bars.Reset(Board.Items.Num());
+    for (const FProjectItem& Item : Board.Items)
+    {
+        const bool bHasStart = IsDateSet(Item.StartDateTime);
+        const bool bHasEnd = IsDateSet(Item.EndDateTime);
+        if (!bHasStart && !bHasEnd)
+        {
+            continue;
+        }
+
+        // Items with one date show up as a single day, like in the timeline index
+        FBar& Bar = Bars.AddDefaulted_GetRef();
+        Bar.ItemId = Item.ItemId;
+        Bar.Title = Item.Title;
+        Bar.Start = ToDays(bHasStart ? Item.StartDateTime : Item.EndDateTime);
+        Bar.End = FMath::Max(Bar.Start, ToDays(bHasEnd ? Item.EndDateTime : Item.StartDateTime)) + 1.0;
+        Bar.Color = GetColumnColor(Item.ColumnId);
+        Bar.bHasStart = bHasStart;
+        Bar.bHasEnd = bHasEnd;
+    }
+
+    TArray<int32> Order;
+    Order.Reserve(Bars.Num());
+    for (int32 Index = 0; Index < Bars.Num(); ++Index)
+    {
+        Order.Add(Index);
+    }
+    Order.Sort([this](int32 A, int32 B) { return Bars[A].Start != Bars[B].Start ? Bars[A].Start < Bars[B].Start : Bars[A].End < Bars[B].End; });
+
+    // Greedy packing, a bar reuses the lane that frees up first if that happens before it starts
+    Lanes.Reset();
+    TArray<FLaneEnd> LaneHeap;
+    for (int32 Index : Order)
+    {
+        const FBar& Bar = Bars[Index];
+        if (LaneHeap.Num() > 0 && LaneHeap.HeapTop().End <= Bar.Start)
+        {
+            FLaneEnd Free;
+            LaneHeap.HeapPop(Free, EAllowShrinking::No);
+            Lanes[Free.Lane].Add(Index);
+            LaneHeap.HeapPush(FLaneEnd{ Bar.End, Free.Lane });
+        }
+        else
+        {
+            LaneHeap.HeapPush(FLaneEnd{ Bar.End, Lanes.Num() });
+            Lanes.AddDefaulted_GetRef().Add(Index);
+        }
+    }
+}
+
+void SGitHubTimeline::FitToBars(float Width)
+{
+    double First = TNumericLimits<double>::Max();
+    double Last = TNumericLimits<double>::Lowest();
+    for (const FBar& Bar : Bars)
+    {
+        First = FMath::Min(First, Bar.Start);
+        Last = FMath::Max(Last, Bar.End);
+    }
+
+    const double Margin = FMath::Max(1.0, (Last - First) * 0.05);
+    PixelsPerDay = FMath::Clamp(FMath::Max(Width, 1.0f) / (Last - First + 2.0 * Margin), MinPixelsPerDay, MaxPixelsPerDay);
+    ViewStart = First - Margin;
+    ScrollY = 0.0f;
+    ClampView(Width);
+}
+
+void SGitHubTimeline::ClampView(float Width)
+{
+    // FDateTime only spans the years 1 to 9999, the header could not name a day outside of them
+    const double LastDay = ToDays(FDateTime::MaxValue());
+    const double VisibleDays = FMath::Max(Width, 1.0f) / PixelsPerDay;
+    ViewStart = FMath::Clamp(ViewStart, ToDays(FDateTime::MinValue()), FMath::Max(0.0, LastDay - VisibleDays));
+}
+
+int32 SGitHubTimeline::GetLanesPerRow() const
+{
+    return FMath::Max(1, FMath::CeilToInt(MinRowHeight / LaneHeight));
+}
+
+void SGitHubTimeline::GetPreviewRange(int32 BarIndex, double& OutStart, double& OutEnd) const
+{
+    const FBar& Bar = Bars[BarIndex];
+    OutStart = Bar.Start;
+    OutEnd = Bar.End;
+    if (BarIndex != DragBarIndex)
+    {
+        return;
+    }
+
+    switch (DragMode)
+    {
+    case EDragMode::Move:
+        OutStart += DragDays;
+        OutEnd += DragDays;
+        break;
+    case EDragMode::Start:
+        OutStart = FMath::Min(OutStart + DragDays, OutEnd - 1.0);
+        break;
+    case EDragMode::End:
+        OutEnd = FMath::Max(OutEnd + DragDays, OutStart + 1.0);
+        break;
+    default:
+        break;
+    }
+}
+
+int32 SGitHubTimeline::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+    GITHUB_TRACE_SCOPE(GitHub_PaintTimeline);
+
+    const FSlateBrush* WhiteBrush = FAppStyle::GetBrush("WhiteBrush");
+    const FSlateFontInfo Font = FAppStyle::GetFontStyle("SmallFont");
+    const FVector2D Size = AllottedGeometry.GetLocalSize();
+    // A widget widened after the view was clamped may still reach past the last representable day
+    const double ViewEnd = FMath::Min(XToDay(Size.X), ToDays(FDateTime::MaxValue()));
+
+    auto DrawBox = [&](int32 Layer, double X, double Y, double Width, double Height, const FLinearColor& Color)
+    {
+        FSlateDrawElement::MakeBox(OutDrawElements, Layer, AllottedGeometry.ToPaintGeometry(FVector2D(Width, Height), FSlateLayoutTransform(FVector2D(X, Y))), WhiteBrush, ESlateDrawEffect::None, Color);
+    };
+    auto DrawLabel = [&](int32 Layer, double X, double Y, double Width, const FString& Text, const FLinearColor& Color)
+    {
+        // Measuring every label would cost more than the bars, an average glyph width is close enough
+        const int32 MaxChars = FMath::FloorToInt((Width - 6.0) / (Font.Size * 0.6));
+        if (MaxChars < 3)
+        {
+            return;
+        }
+        const FString Clipped = Text.Len() > MaxChars ? Text.Left(MaxChars - 2) + TEXT("..") : Text;
+        FSlateDrawElement::MakeText(OutDrawElements, Layer, AllottedGeometry.ToPaintGeometry(FVector2D(Width, Font.Size + 4.0), FSlateLayoutTransform(FVector2D(X + 3.0, Y))), Clipped, Font, ESlateDrawEffect::None, Color);
+    };
+
+    DrawBox(LayerId, 0.0, 0.0, Size.X, Size.Y, FLinearColor(0.015f, 0.015f, 0.015f));
+
+    // Grid and header ticks, days when zoomed in far enough, then months, then years
+    const int32 GridLayer = LayerId + 1;
+    const FDateTime ViewStartDate = FromDays(FMath::Max(ViewStart, 0.0));
+    if (PixelsPerDay >= 24.0)
+    {
+        for (double Day = FMath::FloorToDouble(ViewStart); Day <= ViewEnd; Day += 1.0)
+        {
+            const double X = DayToX(Day);
+            DrawBox(GridLayer, X, HeaderHeight, 1.0, Size.Y - HeaderHeight, FLinearColor(1.0f, 1.0f, 1.0f, 0.04f));
+            DrawLabel(GridLayer, X, 3.0, PixelsPerDay, FromDays(Day).ToString(TEXT("%d")), FLinearColor::Gray);
+        }
+    }
+    else
+    {
+        const bool bMonths = PixelsPerDay * 30.0 >= 48.0;
+        FDateTime Tick = bMonths ? FDateTime(ViewStartDate.GetYear(), ViewStartDate.GetMonth(), 1) : FDateTime(ViewStartDate.GetYear(), 1, 1);
+        while (Tick < FDateTime::MaxValue() && ToDays(Tick) <= ViewEnd)
+        {
+            // There is no tick after December 9999, the last one runs to the end of the range
+            FDateTime Next = FDateTime::MaxValue();
+            if (Tick.GetYear() < 9999 || (bMonths && Tick.GetMonth() < 12))
+            {
+                Next = bMonths
+                    ? (Tick.GetMonth() == 12 ? FDateTime(Tick.GetYear() + 1, 1, 1) : FDateTime(Tick.GetYear(), Tick.GetMonth() + 1, 1))
+                    : FDateTime(Tick.GetYear() + 1, 1, 1);
+            }
+            const double X = DayToX(ToDays(Tick));
+            DrawBox(GridLayer, X, 0.0, 1.0, Size.Y, FLinearColor(1.0f, 1.0f, 1.0f, 0.06f));
+            DrawLabel(GridLayer, X, 3.0, DayToX(ToDays(Next)) - X, Tick.ToString(bMonths ? TEXT("%b %Y") : TEXT("%Y")), FLinearColor::Gray);
+            Tick = Next;
+        }
+    }
+
+    const double TodayX = DayToX(ToDays(FDateTime::Today()));
+    DrawBox(GridLayer, TodayX, HeaderHeight, 2.0, Size.Y - HeaderHeight, FLinearColor(0.8f, 0.1f, 0.1f, 0.6f));
+
+    // Only the rows on screen, and in each lane only the bars that reach into the visible range
+    const int32 BarLayer = LayerId + 2;
+    const int32 LanesPerRow = GetLanesPerRow();
+    const double RowHeight = LanesPerRow * LaneHeight;
+    const int32 RowCount = FMath::DivideAndRoundUp(Lanes.Num(), LanesPerRow);
+    const int32 FirstRow = FMath::Max(0, FMath::FloorToInt(ScrollY / RowHeight));
+    const int32 LastRow = FMath::Min(RowCount - 1, FMath::FloorToInt((ScrollY + Size.Y - HeaderHeight) / RowHeight));
+
+    TArray<FSpan> Spans;
+    for (int32 Row = FirstRow; Row <= LastRow; ++Row)
+    {
+        Spans.Reset();
+        const int32 LastLane = FMath::Min(Lanes.Num(), (Row + 1) * LanesPerRow);
+        for (int32 Lane = Row * LanesPerRow; Lane < LastLane; ++Lane)
+        {
+            const TArray<int32>& LaneBars = Lanes[Lane];
+            int32 Index = Algo::LowerBoundBy(LaneBars, ViewStart, [this](int32 BarIndex) { return Bars[BarIndex].End; });
+            for (; Index < LaneBars.Num() && Bars[LaneBars[Index]].Start < ViewEnd; ++Index)
+            {
+                // The dragged bar is painted on top with its preview dates
+                if (LaneBars[Index] != DragBarIndex)
+                {
+                    const FBar& Bar = Bars[LaneBars[Index]];
+                    Spans.Add(FSpan{ DayToX(Bar.Start), DayToX(Bar.End), LaneBars[Index] });
+                }
+            }
+        }
+        if (LanesPerRow > 1)
+        {
+            Spans.Sort([](const FSpan& A, const FSpan& B) { return A.X0 < B.X0; });
+        }
+
+        const double Y = HeaderHeight + Row * RowHeight - ScrollY;
+        const double Height = FMath::Max(1.0, RowHeight - (RowHeight >= 4.0 ? 2.0 : 0.0));
+        for (int32 First = 0; First < Spans.Num();)
+        {
+            double X0 = Spans[First].X0;
+            double X1 = FMath::Max(Spans[First].X1, X0 + 1.0);
+            FLinearColor Color = Bars[Spans[First].BarIndex].Color;
+            int32 Last = First + 1;
+            for (; Last < Spans.Num() && Spans[Last].X0 <= X1 + MergeGapPixels; ++Last)
+            {
+                X1 = FMath::Max(X1, Spans[Last].X1);
+                if (Bars[Spans[Last].BarIndex].Color != Color)
+                {
+                    Color = FLinearColor(0.5f, 0.5f, 0.5f);
+                }
+            }
+
+            const int32 Count = Last - First;
+            const double Left = FMath::Max(X0, -1.0);
+            const double Width = FMath::Min(X1, Size.X + 1.0) - Left;
+            DrawBox(BarLayer, Left, Y + 1.0, Width, Height, Count > 1 ? Color * 0.75f : Color);
+            if (Height >= Font.Size + 2.0)
+            {
+                DrawLabel(BarLayer + 1, Left, Y + 1.0, Width, Count > 1 ? FString::Printf(TEXT("%d items"), Count) : Bars[Spans[First].BarIndex].Title, FLinearColor::Black);
+            }
+            First = Last;
+        }
+    }
+
+    if (Bars.IsValidIndex(DragBarIndex))
+    {
+        double Start = 0.0;
+        double End = 0.0;
+        GetPreviewRange(DragBarIndex, Start, End);
+        const double Y = HeaderHeight + DragLane * LaneHeight - ScrollY;
+        DrawBox(BarLayer + 2, DayToX(Start), Y + 1.0, (End - Start) * PixelsPerDay, LaneHeight - 2.0, Bars[DragBarIndex].Color * 1.2f);
+        DrawLabel(BarLayer + 3, DayToX(Start), Y + 1.0, FMath::Max((End - Start) * PixelsPerDay, 160.0),
+            FString::Printf(TEXT("%s - %s"), *FromDays(Start).ToString(TEXT("%Y-%m-%d")), *FromDays(End - 1.0).ToString(TEXT("%Y-%m-%d"))), FLinearColor::White);
+    }
+
+    // Header strip over the bars
+    const int32 HeaderLayer = BarLayer + 4;
+    DrawBox(HeaderLayer, 0.0, 0.0, Size.X, HeaderHeight, FLinearColor(0.03f, 0.03f, 0.03f, 0.9f));
+    if (Bars.Num() == 0)
+    {
+        DrawLabel(HeaderLayer + 1, 4.0, 3.0, Size.X, SyncedProjectId.IsEmpty() ? TEXT("Select a project to see its timeline") : TEXT("No dated items"), FLinearColor::Gray);
+    }
+
+    return HeaderLayer + 1;
+}
+
+FVector2D SGitHubTimeline::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+    return FVector2D(400.0, 200.0);
+}
+
+bool SGitHubTimeline::HitTestBar(const FGeometry& MyGeometry, const FVector2D& ScreenPosition, int32& OutLane, int32& OutBarIndex, EDragMode& OutMode) const
+{
+    // Aggregated rows have no single bar to grab
+    if (GetLanesPerRow() > 1)
+    {
+        return false;
+    }
+
+    const FVector2D Local = MyGeometry.AbsoluteToLocal(ScreenPosition);
+    const int32 Lane = FMath::FloorToInt((Local.Y - HeaderHeight + ScrollY) / LaneHeight);
+    if (Local.Y < HeaderHeight || !Lanes.IsValidIndex(Lane))
+    {
+        return false;
+    }
+
+    const double Day = XToDay(Local.X);
+    const TArray<int32>& LaneBars = Lanes[Lane];
+    const int32 Index = Algo::UpperBoundBy(LaneBars, Day, [this](int32 BarIndex) { return Bars[BarIndex].End; });
+    if (!LaneBars.IsValidIndex(Index) || Bars[LaneBars[Index]].Start > Day)
+    {
+        return false;
+    }
+
+    const FBar& Bar = Bars[LaneBars[Index]];
+    const double X0 = DayToX(Bar.Start);
+    const double X1 = DayToX(Bar.End);
+    if (X1 - X0 < MinEditablePixels)
+    {
+        return false;
+    }
+
+    OutLane = Lane;
+    OutBarIndex = LaneBars[Index];
+    OutMode = Local.X - X0 <= EdgeGrabPixels ? EDragMode::Start : (X1 - Local.X <= EdgeGrabPixels ? EDragMode::End : EDragMode::Move);
+    return true;
+}
+
+FReply SGitHubTimeline::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton && MouseEvent.GetEffectingButton() != EKeys::RightMouseButton)
+    {
+        return FReply::Unhandled();
+    }
+
+    DragMode = EDragMode::Pan;
+    DragBarIndex = INDEX_NONE;
+    DragDays = 0;
+    if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
+    {
+        int32 Lane = INDEX_NONE;
+        int32 BarIndex = INDEX_NONE;
+        EDragMode Mode = EDragMode::None;
+        if (HitTestBar(MyGeometry, MouseEvent.GetScreenSpacePosition(), Lane, BarIndex, Mode))
+        {
+            DragMode = Mode;
+            DragLane = Lane;
+            DragBarIndex = BarIndex;
+            DragOriginDay = XToDay(MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()).X);
+        }
+    }
+
+    return FReply::Handled().CaptureMouse(SharedThis(this));
+}
+
+FReply SGitHubTimeline::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (!HasMouseCapture())
+    {
+        return FReply::Unhandled();
+    }
+
+    if (DragMode != EDragMode::Pan && DragDays != 0)
+    {
+        CommitDrag();
+    }
+
+    DragMode = EDragMode::None;
+    DragBarIndex = INDEX_NONE;
+    DragDays = 0;
+    return FReply::Handled().ReleaseMouseCapture();
+}
+
+FReply SGitHubTimeline::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (!HasMouseCapture())
+    {
+        return FReply::Unhandled();
+    }
+
+    if (DragMode == EDragMode::Pan)
+    {
+        const FVector2D Delta = MouseEvent.GetCursorDelta() / MyGeometry.Scale;
+        ViewStart -= Delta.X / PixelsPerDay;
+        ClampView(MyGeometry.GetLocalSize().X);
+        const float MaxScroll = FMath::Max(0.0f, FMath::DivideAndRoundUp(Lanes.Num(), GetLanesPerRow()) * GetLanesPerRow() * LaneHeight - (ViewHeight - HeaderHeight));
+        ScrollY = FMath::Clamp(ScrollY - float(Delta.Y), 0.0f, MaxScroll);
+    }
+    else
+    {
+        const double Day = XToDay(MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()).X);
+        DragDays = FMath::RoundToInt(Day - DragOriginDay);
+    }
+
+    return FReply::Handled();
+}
+
+FReply SGitHubTimeline::OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    const float Factor = MouseEvent.GetWheelDelta() > 0.0f ? 1.25f : 0.8f;
+    const FVector2D Local = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+
+    if (MouseEvent.IsControlDown())
+    {
+        // Keep the lane under the cursor in place
+        const float LaneUnderCursor = (Local.Y - HeaderHeight + ScrollY) / LaneHeight;
+        LaneHeight = FMath::Clamp(LaneHeight * Factor, MinLaneHeight, MaxLaneHeight);
+        ScrollY = FMath::Max(0.0f, LaneUnderCursor * LaneHeight - (float(Local.Y) - HeaderHeight));
+    }
+    else
+    {
+        const double DayUnderCursor = XToDay(Local.X);
+        PixelsPerDay = FMath::Clamp(PixelsPerDay * Factor, MinPixelsPerDay, MaxPixelsPerDay);
+        ViewStart = DayUnderCursor - Local.X / PixelsPerDay;
+        ClampView(MyGeometry.GetLocalSize().X);
+    }
+
+    return FReply::Handled();
+}
+
+FCursorReply SGitHubTimeline::OnCursorQuery(const FGeometry& MyGeometry, const FPointerEvent& CursorEvent) const
+{
+    EDragMode Mode = DragMode;
+    if (Mode == EDragMode::None)
+    {
+        int32 Lane = INDEX_NONE;
+        int32 BarIndex = INDEX_NONE;
+        HitTestBar(MyGeometry, CursorEvent.GetScreenSpacePosition(), Lane, BarIndex, Mode);
+    }
+
+    switch (Mode)
+    {
+    case EDragMode::Start:
+    case EDragMode::End:
+        return FCursorReply::Cursor(EMouseCursor::ResizeLeftRight);
+    case EDragMode::Move:
+        return FCursorReply::Cursor(EMouseCursor::CardinalCross);
+    case EDragMode::Pan:
+        return FCursorReply::Cursor(EMouseCursor::GrabHandClosed);
+    default:
+        return FCursorReply::Unhandled();
+    }
+}
+
+void SGitHubTimeline::CommitDrag()
+{
+    if (!Bars.IsValidIndex(DragBarIndex))
+    {
+        return;
+    }
+
+    const FBar& Bar = Bars[DragBarIndex];
+    double Start = 0.0;
+    double End = 0.0;
+    GetPreviewRange(DragBarIndex, Start, End);
+
+    // Moving keeps single date items single dated, resizing sets the dragged date
+    const bool bSetStart = DragMode == EDragMode::Start || (DragMode == EDragMode::Move && Bar.bHasStart);
+    const bool bSetEnd = DragMode == EDragMode::End || (DragMode == EDragMode::Move && Bar.bHasEnd);
+    if ((bSetStart && StartDateFieldId.IsEmpty()) || (bSetEnd && EndDateFieldId.IsEmpty()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Project %s has no start or end date field, the timeline edit is dropped."), *SyncedProjectId);
+        return;
+    }
+
+    // Both edits of one item are sent together by the mutation queue
+    UGitHubAPIManager* Manager = UGitHubAPIManager::GetInstance();
+    if (bSetStart)
+    {
+        Manager->UpdateProjectItemDateValue(SyncedProjectId, Bar.ItemId, StartDateFieldId, FromDays(Start).ToString(TEXT("%Y-%m-%d")));
+    }
+    if (bSetEnd)
+    {
+        Manager->UpdateProjectItemDateValue(SyncedProjectId, Bar.ItemId, EndDateFieldId, FromDays(End - 1.0).ToString(TEXT("%Y-%m-%d")));
+    }
+}
@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+#include "UGitHubAPIManager.h"
+
+/**
+ * Gantt view of the dated items of one project, painted in a single OnPaint pass.
+ *
+ * Items are packed into lanes of non-overlapping bars once per board snapshot. Painting only visits the lanes
+ * on screen and binary searches each lane for the visible time range. Bars closer together than a couple of
+ * pixels are drawn as one aggregate with their count, and when lanes are zoomed below a readable height several
+ * lanes share one row, so the draw cost follows the widget size instead of the item count.
+ *
+ * Wheel zooms time around the cursor, Ctrl+Wheel zooms lanes, dragging the background pans. Dragging a bar moves
+ * it, dragging its edges changes the start or end date, releasing it goes through UpdateProjectItemDateValue.
+ */
+class SGitHubTimeline : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SGitHubTimeline) {}
+		SLATE_ATTRIBUTE(FString, ProjectId)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FReply OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+	virtual FCursorReply OnCursorQuery(const FGeometry& MyGeometry, const FPointerEvent& CursorEvent) const override;
+
+private:
+	// Bar of one item, in days since 0001-01-01 with an exclusive end
+	struct FBar
+	{
+		FString ItemId;
+		FString Title;
+		double Start = 0.0;
+		double End = 0.0;
+		FLinearColor Color;
+		bool bHasStart = false;
+		bool bHasEnd = false;
+	};
+
+	enum class EDragMode : uint8
+	{
+		None,
+		Pan,
+		Move,
+		Start,
+		End
+	};
+
+	void SyncBoard(const FProjectInfo& Board);
+	void FitToBars(float Width);
+	void ClampView(float Width);
+	void CommitDrag();
+
+	bool HitTestBar(const FGeometry& MyGeometry, const FVector2D& ScreenPosition, int32& OutLane, int32& OutBarIndex, EDragMode& OutMode) const;
+	void GetPreviewRange(int32 BarIndex, double& OutStart, double& OutEnd) const;
+	int32 GetLanesPerRow() const;
+
+	double XToDay(double X) const { return ViewStart + X / PixelsPerDay; }
+	double DayToX(double Day) const { return (Day - ViewStart) * PixelsPerDay; }
+
+	TAttribute<FString> ProjectId;
+	FString SyncedProjectId;
+	FString StartDateFieldId;
+	FString EndDateFieldId;
+	TSharedPtr<const FProjectInfo, ESPMode::ThreadSafe> SeenBoard;
+
+	TArray<FBar> Bars;
+	// Bar indices per lane, sorted by start; bars of one lane never overlap, so their ends are sorted too
+	TArray<TArray<int32>> Lanes;
+
+	double ViewStart = 0.0;
+	double PixelsPerDay = 8.0;
+	float LaneHeight = 18.0f;
+	float ScrollY = 0.0f;
+	float ViewHeight = 0.0f;
+	bool bFitPending = false;
+
+	EDragMode DragMode = EDragMode::None;
+	int32 DragLane = INDEX_NONE;
+	int32 DragBarIndex = INDEX_NONE;
+	double DragOriginDay = 0.0;
+	int32 DragDays = 0;
+};
@@ -8,6 +8,10 @@
 #include "PropertyEditorModule.h"
 #include "IDetailsView.h"
 #include "EditorModeManager.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Layout/SSplitter.h"
+#include "SGitHubKanbanBoard.h"
+#include "SGitHubTimeline.h"
 
 #define LOCTEXT_NAMESPACE "UEGitHubManagerEditorModeToolkit"
 
@@ -18,6 +22,35 @@ FUEGitHubManagerEditorModeToolkit::FUEGitHubManagerEditorModeToolkit()
 void FUEGitHubManagerEditorModeToolkit::Init(const TSharedPtr<IToolkitHost>& InitToolkitHost, TWeakObjectPtr<UEdMode> InOwningMode)
 {
 	FModeToolkit::Init(InitToolkitHost, InOwningMode);
+
+	TSharedRef<SVerticalBox> Content = SNew(SVerticalBox);
+	if (TSharedPtr<SWidget> ToolContent = FModeToolkit::GetInlineContent())
+	{
+		Content->AddSlot()
+			.AutoHeight()
+			[
+				ToolContent.ToSharedRef()
+			];
+	}
+	TSharedRef<SGitHubKanbanBoard> Board = SNew(SGitHubKanbanBoard);
+	Content->AddSlot()
+		.FillHeight(1.0f)
+		[
+			SNew(SSplitter)
+			.Orientation(Orient_Vertical)
+			+ SSplitter::Slot()
+			.Value(0.6f)
+			[
+				Board
+			]
+			+ SSplitter::Slot()
+			.Value(0.4f)
+			[
+				SNew(SGitHubTimeline)
+				.ProjectId(Board, &SGitHubKanbanBoard::GetProjectId)
+			]
+		];
+	InlineContent = Content;
 }
 
 void FUEGitHubManagerEditorModeToolkit::GetToolPaletteNames(TArray<FName>& PaletteNames) const
@@ -25,6 +58,11 @@ void FUEGitHubManagerEditorModeToolkit::GetToolPaletteNames(TArray<FName>& Palet
 	PaletteNames.Add(NAME_Default);
 }
 
+TSharedPtr<SWidget> FUEGitHubManagerEditorModeToolkit::GetInlineContent() const
+{
+	return InlineContent;
+}
+
 
 FName FUEGitHubManagerEditorModeToolkit::GetToolkitFName() const
 {
@@ -5,6 +5,225 @@
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Blueprint/UserWidget.h"
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+#include "GitHubTrace.h"
+#include "GitHubResponseDecoder.h"
+#include "GitHubConnectionPool.h"
+#include "GitHubSearchIndex.h"
+#include "GitHubTimelineIndex.h"
+#include "GitHubBoardDiff.h"
+#include "GitHubMutationQueue.h"
+#include "GitHubRequestTracker.h"
+#include "GitHubStateStore.h"
+#include "GitHubPageSizer.h"
+#include "GitHubEntityCache.h"
+#include "GitHubUsageHistory.h"
+#include "GitHubItemDelivery.h"
+#include "GitHubBoardCache.h"
+#include "GitHubDashboard.h"
+#include "GitHubBoardAnalytics.h"
+#include "GitHubEventLog.h"
+#include "Misc/Paths.h"
+#include "Misc/CoreDelegates.h"
+
+// One project discovery run over the viewer and their organizations, only touched on the game thread
+struct FGitHubProjectDiscovery
+{
+    // Owner logins still to be paged, an empty login stands for the viewer
+    TArray<FString> PendingOwners;
+    int32 ActiveOwners = 0;
+
+    TMap<FString, FProjectInfo> ProjectsById;
+    TArray<FString> ProjectOrder;
+};
+
+struct FGitHubDashboardRun
+{
+    // Projects still to be counted
+    TArray<FString> PendingProjects;
+    int32 ActiveProjects = 0;
+};
+
+namespace
+{
+    // Backoff between replay attempts of the mutation queue while GitHub is unreachable
+    constexpr float MinMutationRetryDelay = 2.0f;
+    constexpr float MaxMutationRetryDelay = 60.0f;
+
+    // Edits of one item sent together in a single aliased mutation
+    constexpr int32 MaxMutationBatchSize = 8;
+
+    // GitHub accepts at most 100 ids per nodes(ids: [...]) lookup
+    constexpr int32 MaxNodesPerLookup = 100;
+
+    // Full content of an issue, pull request or draft issue for the entity cache
+    constexpr const TCHAR* ContentSelection = TEXT(
+        "__typename "
+        "... on Issue { id title url issueState: state createdAt updatedAt body } "
+        "... on PullRequest { id title url pullRequestState: state createdAt updatedAt body } "
+        "... on DraftIssue { id title body createdAt updatedAt } ");
+
+    // Project date fields come as plain dates ("2024-05-01"), edits may send full ISO 8601 timestamps
+    FDateTime ParseProjectDate(const FString& DateValue)
+    {
+        FDateTime Result;
+        if (DateValue.IsEmpty() || !FDateTime::ParseIso8601(*DateValue, Result))
+        {
+            return FDateTime();
+        }
+        return Result;
+    }
+
+    // Brings back what an item showed before its content could not be looked up
+    void KeepContent(const FProjectItem& Previous, FProjectItem& Item)
+    {
+        Item.Type = Previous.Type;
+        Item.Title = Previous.Title;
+        Item.Url = Previous.Url;
+        Item.State = Previous.State;
+        Item.CreatedAt = Previous.CreatedAt;
+        Item.UpdatedAt = Previous.UpdatedAt;
+        Item.Body = Previous.Body;
+        Item.bContentMissing = false;
+    }
+
+    // One project item with its field values and a reference to its content, for board pages and item lookups
+    constexpr const TCHAR* ItemSelection = TEXT(
+        "id "
+        "fieldValues(first: 8) { "
+        "  nodes { "
+        "    ... on ProjectV2ItemFieldDateValue { "
+        "      id "
+        "      date "
+        "      field { "
+        "        ... on ProjectV2Field { "
+        "          id "
+        "          name "
+        "          dataType "
+        "        } "
+        "      } "
+        "    } "
+        "    ... on ProjectV2ItemFieldSingleSelectValue { "
+        "      id "
+        "      name "
+        "      optionId "
+        "      field { "
+        "        ... on ProjectV2SingleSelectField { "
+        "          id "
+        "          name "
+        "        } "
+        "      } "
+        "    } "
+        "  } "
+        "} "
+        "content { "
+        "  __typename "
+        "  ... on Issue { id updatedAt } "
+        "  ... on PullRequest { id updatedAt } "
+        "  ... on DraftIssue { id updatedAt } "
+        "} ");
+
+    // Everything a board needs: fields with their options, and one page of items with their field values.
+    // Content only comes as id and version, the entity cache fills in what it does not have yet.
+    FString MakeProjectDetailsQuery(const FString& ProjectId, int32 PageSize, const FString& Cursor)
+    {
+        const FString After = Cursor.IsEmpty() ? FString() : FString::Printf(TEXT(", after: \"%s\""), *Cursor);
+        return FString::Printf(TEXT(
+            "query { "
+            "  node(id: \"%s\") { "
+            "    ... on ProjectV2 { "
+            "      id "
+            "      title "
+            "      url "
+            "      fields(first: 20) { "
+            "        nodes { "
+            "          ... on ProjectV2Field { "
+            "            id "
+            "            name "
+            "            dataType "
+            "          } "
+            "          ... on ProjectV2SingleSelectField { "
+            "            id "
+            "            name "
+            "            options { "
+            "              id "
+            "              name "
+            "            } "
+            "          } "
+            "        } "
+            "      } "
+            "      items(first: %d%s) { "
+            "        pageInfo { hasNextPage endCursor } "
+            "        nodes { "
+            "          %s "
+            "        } "
+            "      } "
+            "    } "
+            "  } "
+            "  rateLimit { cost } "
+            "}"), *ProjectId, PageSize, *After, ItemSelection);
+    }
+
+    // Only what the dashboard counts, the status and the state of every item
+    FString MakeProjectCountsQuery(const FString& ProjectId, int32 PageSize, const FString& Cursor)
+    {
+        const FString After = Cursor.IsEmpty() ? FString() : FString::Printf(TEXT(", after: \"%s\""), *Cursor);
+        return FString::Printf(TEXT(
+            "query { "
+            "  node(id: \"%s\") { "
+            "    ... on ProjectV2 { "
+            "      title "
+            "      items(first: %d%s) { "
+            "        pageInfo { hasNextPage endCursor } "
+            "        nodes { "
+            "          fieldValueByName(name: \"Status\") { "
+            "            ... on ProjectV2ItemFieldSingleSelectValue { name } "
+            "          } "
+            "          content { "
+            "            __typename "
+            "            ... on Issue { issueState: state } "
+            "            ... on PullRequest { pullRequestState: state } "
+            "          } "
+            "        } "
+            "      } "
+            "    } "
+            "  } "
+            "  rateLimit { cost } "
+            "}"), *ProjectId, PageSize, *After);
+    }
+
+    // Nodes on the page of the connection at ConnectionPath ("data", "viewer", "repositories")
+    int32 CountPageNodes(const TSharedPtr<FJsonObject>& ResponseObject, const TArray<FString>& ConnectionPath)
+    {
+        TSharedPtr<FJsonObject> Object = ResponseObject;
+        for (const FString& ObjectField : ConnectionPath)
+        {
+            const TSharedPtr<FJsonObject>* Child = nullptr;
+            if (!Object->TryGetObjectField(ObjectField, Child))
+            {
+                return 0;
+            }
+            Object = *Child;
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* Nodes = nullptr;
+        return Object->TryGetArrayField(TEXT("nodes"), Nodes) ? Nodes->Num() : 0;
+    }
+
+    // Rate limit points GitHub charged for the query, 0 if the query did not ask for rateLimit
+    int32 GetQueryCost(const TSharedPtr<FJsonObject>& ResponseObject)
+    {
+        const TSharedPtr<FJsonObject>* DataObject = nullptr;
+        const TSharedPtr<FJsonObject>* RateLimitObject = nullptr;
+        int32 Cost = 0;
+        if (ResponseObject->TryGetObjectField(TEXT("data"), DataObject) && (*DataObject)->TryGetObjectField(TEXT("rateLimit"), RateLimitObject))
+        {
+            (*RateLimitObject)->TryGetNumberField(TEXT("cost"), Cost);
+        }
+        return Cost;
+    }
+}
 
 UGitHubAPIManager* UGitHubAPIManager::SingletonInstance = nullptr;
 
@@ -21,6 +240,65 @@ UGitHubAPIManager* UGitHubAPIManager::GetInstance()
 UGitHubAPIManager::UGitHubAPIManager()
 {
     Http = &FHttpModule::Get();
+    ConnectionPool = MakeShared<FGitHubConnectionPool, ESPMode::ThreadSafe>();
+    RequestTracker = MakeShared<FGitHubRequestTracker, ESPMode::ThreadSafe>();
+    StateStore = MakeShared<FGitHubStateStore, ESPMode::ThreadSafe>();
+    EntityCache = MakeShared<FGitHubEntityCache, ESPMode::ThreadSafe>();
+
+    // GitHub caps every connection at 100 nodes per page
+    PageSizer = MakeShared<FGitHubPageSizer, ESPMode::ThreadSafe>();
+    PageSizer->Register(TEXT("Repositories"), 100, 10, 100);
+    PageSizer->Register(TEXT("Projects"), 100, 10, 100);
+    PageSizer->Register(TEXT("ProjectItems"), 100, 5, 100);
+    PageSizer->Register(TEXT("ProjectCounts"), 100, 10, 100);
+    MutationQueue = MakeShared<FGitHubMutationQueue>(FPaths::ProjectSavedDir() / TEXT("GitHubManager") / TEXT("MutationJournal.json"));
+    ItemDelivery = MakeShared<FGitHubItemDelivery>();
+    UsageHistory = MakeShared<FGitHubUsageHistory>(FPaths::ProjectSavedDir() / TEXT("GitHubManager") / TEXT("UsageHistory.json"));
+    BoardCache = MakeShared<FGitHubBoardCache>(FPaths::ProjectSavedDir() / TEXT("GitHubManager") / TEXT("BoardCache"));
+    Dashboard = MakeShared<FGitHubDashboard>();
+    EventLog = MakeShared<FGitHubEventLog>(FPaths::ProjectSavedDir() / TEXT("GitHubManager") / TEXT("EventLog"));
+}
+
+void UGitHubAPIManager::PostInitProperties()
+{
+    Super::PostInitProperties();
+
+    // Config values are only available once the properties are initialized
+    ConnectionPool->SetSettings(ConnectionSettings);
+
+    if (!HasAnyFlags(RF_ClassDefaultObject))
+    {
+        MutationQueue->Load();
+        UsageHistory->Load();
+        BoardCache->ClearSpillFiles();
+
+        // The manager is not always destroyed before the process ends
+        PreExitHandle = FCoreDelegates::OnPreExit.AddUObject(this, &UGitHubAPIManager::FlushBeforeExit);
+    }
+}
+
+void UGitHubAPIManager::BeginDestroy()
+{
+    if (!HasAnyFlags(RF_ClassDefaultObject))
+    {
+        FCoreDelegates::OnPreExit.Remove(PreExitHandle);
+        FlushBeforeExit();
+    }
+
+    Super::BeginDestroy();
+}
+
+void UGitHubAPIManager::FlushBeforeExit()
+{
+    FlushEventLogNow();
+    MutationQueue->SaveStaged();
+}
+
+void UGitHubAPIManager::FlushEventLogNow()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(EventLogFlushHandle);
+    EventLogFlushHandle.Reset();
+    EventLog->FlushAndWait();
 }
 
 void UGitHubAPIManager::InitializeIntegration(const FString& UserAccessToken)
@@ -40,6 +318,77 @@ void UGitHubAPIManager::SetAccessToken(const FString& AuthToken)
     }
     
     UE_LOG(LogTemp, Log, TEXT("Access Token has been set."));
+
+    if (ConnectionSettings.bWarmUpOnTokenSet)
+    {
+        WarmUpConnection();
+    }
+
+    // Edits left over from an earlier session or outage go out first
+    PumpMutationQueue();
+}
+
+void UGitHubAPIManager::SetConnectionSettings(const FGitHubConnectionSettings& NewSettings)
+{
+    ConnectionSettings = NewSettings;
+    ConnectionPool->SetSettings(ConnectionSettings);
+}
+
+void UGitHubAPIManager::WarmUpConnection()
+{
+    // rate_limit is free and tiny, enough to get DNS, TCP and TLS out of the way before the first real call
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateHttpRequest("https://api.github.com/rate_limit", "GET");
+
+    FGitHubTraceFlowPtr Flow = GitHubTrace::BeginFlow(TEXT("WarmUpConnection"));
+    Request->OnProcessRequestComplete().BindLambda([Flow](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bWasSuccessful)
+        {
+            Flow->MarkStage(TEXT("Completed"));
+            UE_LOG(LogTemp, Verbose, TEXT("Connection warm-up to api.github.com %s."), bWasSuccessful ? TEXT("succeeded") : TEXT("failed"));
+        });
+
+    DispatchRequest(Request);
+}
+
+FGitHubConnectionStats UGitHubAPIManager::GetConnectionStats() const
+{
+    return ConnectionPool->GetStats();
+}
+
+int32 UGitHubAPIManager::GetPageSize(const FString& QueryShape) const
+{
+    return PageSizer->GetPageSize(QueryShape);
+}
+
+int32 UGitHubAPIManager::GetCachedEntityCount() const
+{
+    return EntityCache->Num();
+}
+
+FGitHubRequestHandle UGitHubAPIManager::BeginSupersedingRequest(const FString& Slot, TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request)
+{
+    TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Superseded;
+    const FGitHubRequestHandle Handle = RequestTracker->Begin(Slot, Request, Superseded);
+    if (Superseded.IsValid())
+    {
+        ConnectionPool->Cancel(Superseded.ToSharedRef());
+    }
+    return Handle;
+}
+
+FGitHubRequestHandle UGitHubAPIManager::BeginSupersedingLoad(const FString& Slot)
+{
+    TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Superseded;
+    const FGitHubRequestHandle Handle = RequestTracker->Begin(Slot, Superseded);
+    if (Superseded.IsValid())
+    {
+        ConnectionPool->Cancel(Superseded.ToSharedRef());
+    }
+    return Handle;
+}
+
+void UGitHubAPIManager::DispatchRequest(TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request, EGitHubRequestPriority Priority)
+{
+    ConnectionPool->Submit(Request, Priority);
 }
 
 void UGitHubAPIManager::FetchCurrentUser()
@@ -50,39 +399,31 @@ void UGitHubAPIManager::FetchCurrentUser()
         return;
     }
 
-    FString Query = TEXT("query { viewer { login } }");
-
-    SendGraphQLQuery(Query, [this](TSharedPtr<FJsonObject> ResponseObject)
+    FetchCurrentUserAsync().Next([this](TGitHubResult<FString> Result)
         {
-            if (!ResponseObject.IsValid())
-            {
-                UE_LOG(LogTemp, Error, TEXT("Invalid response from server."));
-                return;
-            }
-
-            TSharedPtr<FJsonObject> DataObject = ResponseObject->GetObjectField("data");
-            if (!DataObject.IsValid())
-            {
-                UE_LOG(LogTemp, Error, TEXT("Error parsing data object."));
-                return;
-            }
-
-            TSharedPtr<FJsonObject> ViewerObject = DataObject->GetObjectField("viewer");
-            if (!ViewerObject.IsValid())
+            if (Result.HasError())
             {
-                UE_LOG(LogTemp, Error, TEXT("Viewer data not found."));
+                UE_LOG(LogTemp, Error, TEXT("Fetching the current user failed: %s"), *Result.GetError());
                 return;
             }
 
-            FString UserName = GetStringFieldSafe(ViewerObject, "login");
-
-            AsyncTask(ENamedThreads::GameThread, [this, UserName]()
+            RunOnGameThread([this, UserName = Result.StealValue()]()
                 {
                     OnUserNameReceived.Broadcast(UserName);
                 });
         });
 }
 
+TGitHubFuture<FString> UGitHubAPIManager::FetchCurrentUserAsync(const FGitHubCancellationTokenPtr& Token)
+{
+    if (AccessToken.IsEmpty())
+    {
+        return GitHubAsync::MakeReady<FString>(MakeError(TEXT("Access Token is empty.")));
+    }
+
+    return QueryStringFieldAsync(TEXT("query { viewer { login } }"), { TEXT("data"), TEXT("viewer") }, TEXT("login"), TEXT("FetchCurrentUser"), Token);
+}
+
 void UGitHubAPIManager::LogHttpError(FHttpResponsePtr Response) const
 {
     if (Response.IsValid())
@@ -102,6 +443,7 @@ TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UGitHubAPIManager::CreateHttpReque
     Request->SetVerb(Verb);
     Request->SetHeader("Authorization", "Bearer " + AccessToken);
     Request->SetHeader("User-Agent", "UEGitHubManager");
+    Request->SetHeader("Accept-Encoding", GITHUB_ACCEPT_ENCODING);
 
     if (Verb == "POST" || Verb == "PATCH")
     {
@@ -111,75 +453,326 @@ TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UGitHubAPIManager::CreateHttpReque
     return Request;
 }
 
-void UGitHubAPIManager::FetchUserRepositories()
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UGitHubAPIManager::CreateGraphQLRequest(const FString& Document)
 {
-    if (AccessToken.IsEmpty())
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateHttpRequest("https://api.github.com/graphql", "POST");
+
+    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+    JsonObject->SetStringField("query", Document);
+
+    FString RequestBody;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
+    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+    Request->SetContentAsString(RequestBody);
+
+    return Request;
+}
+
+bool UGitHubAPIManager::DecodeResponseBody(FHttpResponsePtr Response, FString& OutBody)
+{
+    FGitHubDecodedBody Decoded;
+    if (!GitHubResponseDecoder::Decode(Response, Decoded))
     {
-        UE_LOG(LogTemp, Error, TEXT("Access Token is empty. Cannot retrieve repositories."));
-        return;
+        return false;
+    }
+
+    {
+        FScopeLock Lock(&TransferStatsLock);
+        TransferStats.ResponseCount++;
+        TransferStats.CompressedBytes += Decoded.WireBytes;
+        TransferStats.UncompressedBytes += Decoded.DecodedBytes;
     }
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateHttpRequest("https://api.github.com/user/repos", "GET");
-    Request->OnProcessRequestComplete().BindUObject(this, &UGitHubAPIManager::HandleRepoListResponse);
-    Request->ProcessRequest();
+    UE_LOG(LogTemp, Verbose, TEXT("%s: %lld bytes received, %lld bytes decoded."), *Response->GetURL(), Decoded.WireBytes, Decoded.DecodedBytes);
+
+    OutBody = MoveTemp(Decoded.Text);
+    return true;
 }
 
-void UGitHubAPIManager::HandleRepoListResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+TSharedPtr<FJsonObject> UGitHubAPIManager::DeserializeGraphQLResponse(FHttpResponsePtr Response, bool* bOutOversized)
 {
-    if (bWasSuccessful && Response->GetResponseCode() == 200)
+    TSharedPtr<FJsonObject> ResponseObject;
+    bool bDeserialized = false;
+
+    FString Body;
+    if (DecodeResponseBody(Response, Body))
+    {
+        GITHUB_TRACE_SCOPE(GitHub_DeserializeJson);
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Body);
+        bDeserialized = FJsonSerializer::Deserialize(Reader, ResponseObject);
+    }
+
+    if (FGitHubTraceFlowPtr Flow = GitHubTrace::GetCurrentFlow())
+    {
+        Flow->MarkStage(TEXT("Decoded"));
+    }
+
+    if (!bDeserialized)
     {
-        TArray<TSharedPtr<FJsonValue>> JsonArray;
-        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+        UE_LOG(LogTemp, Error, TEXT("Fehler beim Deserialisieren der JSON-Antwort."));
+        return nullptr;
+    }
+
+    if (ResponseObject->HasField("errors"))
+    {
+        const TArray<TSharedPtr<FJsonValue>>& Errors = ResponseObject->GetArrayField("errors");
+        for (const TSharedPtr<FJsonValue>& ErrorValue : Errors)
+        {
+            TSharedPtr<FJsonObject> ErrorObject = ErrorValue->AsObject();
+            FString Message = ErrorObject->GetStringField("message");
+            UE_LOG(LogTemp, Error, TEXT("GraphQL Fehler: %s"), *Message);
+
+            // Queries over the node or resource limit succeed when asked for less at once
+            const FString Type = GetStringFieldSafe(ErrorObject, "type");
+            if (bOutOversized && (Type == TEXT("MAX_NODE_LIMIT_EXCEEDED") || Type == TEXT("RESOURCE_LIMITS_EXCEEDED")))
+            {
+                *bOutOversized = true;
+            }
+        }
+        return nullptr;
+    }
+
+    return ResponseObject;
+}
+
+FGitHubTransferStats UGitHubAPIManager::GetTransferStats() const
+{
+    FScopeLock Lock(&TransferStatsLock);
+    return TransferStats;
+}
+
+void UGitHubAPIManager::ResetTransferStats()
+{
+    FScopeLock Lock(&TransferStatsLock);
+    TransferStats = FGitHubTransferStats();
+}
 
-        if (FJsonSerializer::Deserialize(Reader, JsonArray))
+void UGitHubAPIManager::RunOnWorkerThread(const FGitHubTraceFlowPtr& Flow, TUniqueFunction<void()> Task)
+{
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Flow, Task = MoveTemp(Task)]() mutable
         {
-            RepositoryInfos.Empty();
+            GitHubTrace::FFlowScope FlowScope(Flow);
+            Task();
+        });
+}
 
-            for (const TSharedPtr<FJsonValue>& Value : JsonArray)
+void UGitHubAPIManager::RunOnGameThread(TUniqueFunction<void()> Task)
+{
+    FGitHubTraceFlowPtr Flow = GitHubTrace::GetCurrentFlow();
+    AsyncTask(ENamedThreads::GameThread, [Flow, Task = MoveTemp(Task)]() mutable
+        {
+            GITHUB_TRACE_SCOPE(GitHub_GameThreadBroadcast);
+            if (Flow.IsValid())
             {
-                TSharedPtr<FJsonObject> Obj = Value->AsObject();
-                FString RepoName = GetStringFieldSafe(Obj, "name");
-                FString OwnerName = GetStringFieldSafe(Obj->GetObjectField("owner"), "login");
+                Flow->MarkStage(TEXT("Broadcast"));
+            }
+
+            GitHubTrace::FFlowScope FlowScope(Flow);
+            Task();
+        });
+}
+
+void UGitHubAPIManager::FetchUserRepositories()
+{
+    if (AccessToken.IsEmpty())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Access Token is empty. Cannot retrieve repositories."));
+        return;
+    }
+
+    FetchRepositoryPage(MakeShared<TMap<FString, FRepositoryInfo>, ESPMode::ThreadSafe>(), FString());
+}
 
-                FRepositoryInfo RepoInfo;
-                RepoInfo.RepositoryName = RepoName;
-                RepoInfo.Owner = OwnerName;
+void UGitHubAPIManager::FetchRepositoryPage(TSharedRef<TMap<FString, FRepositoryInfo>, ESPMode::ThreadSafe> LoadedRepositories, const FString& Cursor)
+{
+    // One query returns everything FRepositoryInfo needs, so the list never has to be completed per repository.
+    // Affiliations match the /user/repos defaults.
+    const FString After = Cursor.IsEmpty() ? FString() : FString::Printf(TEXT(", after: \"%s\""), *Cursor);
+    auto BuildQuery = [After](int32 PageSize)
+        {
+            return FString::Printf(TEXT(
+                "query { "
+                "  viewer { "
+                "    repositories(first: %d%s, ownerAffiliations: [OWNER, COLLABORATOR, ORGANIZATION_MEMBER]) { "
+                "      nodes { "
+                "        name "
+                "        owner { login } "
+                "        description "
+                "        createdAt "
+                "        stargazerCount "
+                "        forkCount "
+                "      } "
+                "      pageInfo { hasNextPage endCursor } "
+                "    } "
+                "  } "
+                "  rateLimit { cost } "
+                "}"), PageSize, *After);
+        };
+
+    SendPagedQuery(TEXT("Repositories"), { TEXT("data"), TEXT("viewer"), TEXT("repositories") }, BuildQuery, [this, LoadedRepositories](TSharedPtr<FJsonObject> ResponseObject)
+        {
+            FString NextCursor;
+            if (!HandleRepoListResponse(ResponseObject, *LoadedRepositories, NextCursor))
+            {
+                return;
+            }
 
-                RepositoryInfos.Add(RepoName, RepoInfo);
+            if (!NextCursor.IsEmpty())
+            {
+                FetchRepositoryPage(LoadedRepositories, NextCursor);
+                return;
             }
 
-            TArray<FRepositoryInfo> Values;
-            RepositoryInfos.GenerateValueArray(Values);
+            // The published list is built once here, GetRepositoryList and every listener share it
+            TSharedRef<TArray<FRepositoryInfo>, ESPMode::ThreadSafe> Snapshot = MakeShared<TArray<FRepositoryInfo>, ESPMode::ThreadSafe>();
+            LoadedRepositories->GenerateValueArray(*Snapshot);
 
-            AsyncTask(ENamedThreads::GameThread, [this, Values]()
+            // Published right here on the worker, the game thread only broadcasts
+            StateStore->Update([&LoadedRepositories, &Snapshot](FGitHubManagerState& State)
                 {
-                    OnRepositoriesLoaded.Broadcast(Values);
+                    State.RepositoryInfos = MoveTemp(*LoadedRepositories);
+                    State.RepositoryList = Snapshot;
                 });
+
+            RunOnGameThread([this, Snapshot]()
+                {
+                    FGitHubRepositoryListHandle Handle;
+                    Handle.Snapshot = Snapshot;
+                    OnRepositoryListPublished.Broadcast(Handle);
+
+                    if (OnRepositoriesLoaded.IsBound())
+                    {
+                        OnRepositoriesLoaded.Broadcast(*Snapshot);
+                    }
+                });
+        }, TEXT("FetchUserRepositories"));
+}
+
+bool UGitHubAPIManager::HandleRepoListResponse(TSharedPtr<FJsonObject> ResponseObject, TMap<FString, FRepositoryInfo>& OutRepositories, FString& OutNextCursor)
+{
+    GITHUB_TRACE_SCOPE(GitHub_ParseRepoList);
+
+    const TSharedPtr<FJsonObject>* DataObject;
+    const TSharedPtr<FJsonObject>* ViewerObject;
+    const TSharedPtr<FJsonObject>* RepositoriesObject;
+    const TArray<TSharedPtr<FJsonValue>>* RepositoryNodes;
+    if (!ResponseObject.IsValid()
+        || !ResponseObject->TryGetObjectField("data", DataObject)
+        || !(*DataObject)->TryGetObjectField("viewer", ViewerObject)
+        || !(*ViewerObject)->TryGetObjectField("repositories", RepositoriesObject)
+        || !(*RepositoriesObject)->TryGetArrayField("nodes", RepositoryNodes))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Repository list could not be parsed."));
+        return false;
+    }
+
+    for (const TSharedPtr<FJsonValue>& Value : *RepositoryNodes)
+    {
+        TSharedPtr<FJsonObject> Obj = Value->AsObject();
+        if (!Obj.IsValid())
+        {
+            continue;
+        }
+
+        FRepositoryInfo RepoInfo;
+        RepoInfo.RepositoryName = GetStringFieldSafe(Obj, "name");
+        RepoInfo.CreatedAt = GetStringFieldSafe(Obj, "createdAt");
+        RepoInfo.Stars = GetIntegerFieldSafe(Obj, "stargazerCount").Get(0);
+        RepoInfo.Forks = GetIntegerFieldSafe(Obj, "forkCount").Get(0);
+
+        // description is null for repositories without one
+        Obj->TryGetStringField(TEXT("description"), RepoInfo.Description);
+
+        const TSharedPtr<FJsonObject>* OwnerObject;
+        if (Obj->TryGetObjectField("owner", OwnerObject))
+        {
+            RepoInfo.Owner = GetStringFieldSafe(*OwnerObject, "login");
         }
+
+        OutRepositories.Add(RepoInfo.RepositoryName, RepoInfo);
     }
-    else
+
+    const TSharedPtr<FJsonObject>* PageInfoObject;
+    bool bHasNextPage = false;
+    if ((*RepositoriesObject)->TryGetObjectField("pageInfo", PageInfoObject) && (*PageInfoObject)->TryGetBoolField("hasNextPage", bHasNextPage) && bHasNextPage)
     {
-        LogHttpError(Response);
+        OutNextCursor = GetStringFieldSafe(*PageInfoObject, "endCursor");
     }
+
+    return true;
 }
 
 TArray<FRepositoryInfo> UGitHubAPIManager::GetRepositoryList()
 {
-    TArray<FRepositoryInfo> Values;
-    RepositoryInfos.GenerateValueArray(Values);
-    return Values;
+    const FGitHubStateSnapshot State = StateStore->Read();
+    return State->RepositoryList.IsValid() ? *State->RepositoryList : TArray<FRepositoryInfo>();
+}
+
+FGitHubRepositoryListHandle UGitHubAPIManager::GetRepositoryListHandle() const
+{
+    FGitHubRepositoryListHandle Handle;
+    Handle.Snapshot = StateStore->Read()->RepositoryList;
+    return Handle;
+}
+
+FGitHubProjectListHandle UGitHubAPIManager::GetProjectListHandle() const
+{
+    FGitHubProjectListHandle Handle;
+    Handle.Snapshot = StateStore->Read()->ProjectList;
+    return Handle;
+}
+
+FGitHubBoardHandle UGitHubAPIManager::GetBoardHandle(const FString& ProjectId)
+{
+    FGitHubBoardHandle Handle;
+    if (const TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* Board = FindLoadedBoard(ProjectId))
+    {
+        Handle.Snapshot = *Board;
+    }
+    return Handle;
 }
 
 void UGitHubAPIManager::FetchRepositoryDetails(const FString& RepositoryName)
 {
-    if (RepositoryInfos.Contains(RepositoryName))
+    const FGitHubStateSnapshot State = StateStore->Read();
+    if (const FRepositoryInfo* Repository = State->RepositoryInfos.Find(RepositoryName))
     {
-        FRepositoryInfo SelectedRepo = RepositoryInfos[RepositoryName];
+        const FRepositoryInfo& SelectedRepo = *Repository;
+
+        // The list query already carries all details, only entries added some other way need the REST call
+        if (!SelectedRepo.CreatedAt.IsEmpty())
+        {
+            // A REST lookup still running for an earlier selection must not overwrite this one
+            if (TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Superseded = RequestTracker->Invalidate(TEXT("RepositoryDetails")))
+            {
+                ConnectionPool->Cancel(Superseded.ToSharedRef());
+            }
+
+            StateStore->Update([&SelectedRepo](FGitHubManagerState& NewState) { NewState.ActiveRepository = SelectedRepo; });
+            OnRepositoryDetailsLoaded.Broadcast(SelectedRepo);
+            return;
+        }
+
         FString URL = FString::Printf(TEXT("https://api.github.com/repos/%s/%s"), *SelectedRepo.Owner, *SelectedRepo.RepositoryName);
 
         TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateHttpRequest(URL, "GET");
-        Request->OnProcessRequestComplete().BindUObject(this, &UGitHubAPIManager::HandleRepoDetailsResponse);
-        Request->ProcessRequest();
+        FGitHubTraceFlowPtr Flow = GitHubTrace::BeginFlow(TEXT("FetchRepositoryDetails"));
+        const FGitHubRequestHandle Handle = BeginSupersedingRequest(TEXT("RepositoryDetails"), Request);
+        Request->OnProcessRequestComplete().BindLambda([this, Flow, Handle](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bWasSuccessful)
+            {
+                Flow->MarkStage(TEXT("Completed"));
+                if (!RequestTracker->IsCurrent(Handle))
+                {
+                    Flow->MarkStage(TEXT("Superseded"));
+                    return;
+                }
+
+                RunOnWorkerThread(Flow, [this, RequestPtr, ResponsePtr, bWasSuccessful, Handle]()
+                    {
+                        HandleRepoDetailsResponse(RequestPtr, ResponsePtr, bWasSuccessful, Handle);
+                    });
+            });
+        DispatchRequest(Request);
     }
     else
     {
@@ -187,30 +780,47 @@ void UGitHubAPIManager::FetchRepositoryDetails(const FString& RepositoryName)
     }
 }
 
-void UGitHubAPIManager::HandleRepoDetailsResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+void UGitHubAPIManager::HandleRepoDetailsResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, const FGitHubRequestHandle& Handle)
 {
-    if (bWasSuccessful && Response->GetResponseCode() == 200)
+    GITHUB_TRACE_SCOPE(GitHub_ParseRepoDetails);
+
+    // Superseded while waiting for a worker
+    if (!RequestTracker->IsCurrent(Handle))
+    {
+        return;
+    }
+
+    FString Body;
+    if (bWasSuccessful && Response->GetResponseCode() == 200 && DecodeResponseBody(Response, Body))
     {
         TSharedPtr<FJsonObject> JsonObject;
-        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Body);
 
-        if (FJsonSerializer::Deserialize(Reader, JsonObject))
+        FRepositoryInfo LoadedRepository;
+        const bool bParsed = FJsonSerializer::Deserialize(Reader, JsonObject);
+        if (bParsed)
         {
-            ActiveRepository.RepositoryName = GetStringFieldSafe(JsonObject, "name");
-            ActiveRepository.Owner = GetStringFieldSafe(JsonObject->GetObjectField("owner"), "login");
-            ActiveRepository.Description = GetStringFieldSafe(JsonObject, "description");
-            ActiveRepository.CreatedAt = GetStringFieldSafe(JsonObject, "created_at");
-
-            ActiveRepository.Stars = JsonObject->HasField("stargazers_count") ? JsonObject->GetIntegerField("stargazers_count") : 0;
-            ActiveRepository.Forks = JsonObject->HasField("forks_count") ? JsonObject->GetIntegerField("forks_count") : 0;
+            LoadedRepository.RepositoryName = GetStringFieldSafe(JsonObject, "name");
+            LoadedRepository.Owner = GetStringFieldSafe(JsonObject->GetObjectField("owner"), "login");
+            LoadedRepository.Description = GetStringFieldSafe(JsonObject, "description");
+            LoadedRepository.CreatedAt = GetStringFieldSafe(JsonObject, "created_at");
 
+            LoadedRepository.Stars = JsonObject->HasField("stargazers_count") ? JsonObject->GetIntegerField("stargazers_count") : 0;
+            LoadedRepository.Forks = JsonObject->HasField("forks_count") ? JsonObject->GetIntegerField("forks_count") : 0;
         }
 
-        FRepositoryInfo RepositoryCopy = ActiveRepository;
-
-        AsyncTask(ENamedThreads::GameThread, [this, RepositoryCopy]()
+        RunOnGameThread([this, bParsed, LoadedRepository, Handle]()
             {
-                OnRepositoryDetailsLoaded.Broadcast(RepositoryCopy);
+                // Only the most recent selection may become the active repository
+                if (!RequestTracker->IsCurrent(Handle))
+                {
+                    return;
+                }
+
+                const FGitHubStateSnapshot State = bParsed
+                    ? StateStore->Update([&LoadedRepository](FGitHubManagerState& NewState) { NewState.ActiveRepository = LoadedRepository; })
+                    : StateStore->Read();
+                OnRepositoryDetailsLoaded.Broadcast(State->ActiveRepository);
             });
     }
     else
@@ -219,609 +829,2408 @@ void UGitHubAPIManager::HandleRepoDetailsResponse(FHttpRequestPtr Request, FHttp
     }
 }
 
-void UGitHubAPIManager::SendGraphQLQuery(const FString& Query, const TFunction<void(TSharedPtr<FJsonObject>)>& Callback)
+void UGitHubAPIManager::SendGraphQLQuery(const FString& Query, const TFunction<void(TSharedPtr<FJsonObject>)>& Callback, const TCHAR* TraceLabel, const FString& SupersedeSlot)
 {
-    FString URL = "https://api.github.com/graphql";
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateGraphQLRequest(Query);
 
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Http->CreateRequest();
-    Request->SetURL(URL);
-    Request->SetVerb("POST");
-    Request->SetHeader("Authorization", "Bearer " + AccessToken);
-    Request->SetHeader("User-Agent", "UEGitHubManager");
-    Request->SetHeader("Content-Type", "application/json");
-
-    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-    JsonObject->SetStringField("query", Query);
-
-    FString RequestBody;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+    FGitHubTraceFlowPtr Flow = GitHubTrace::BeginFlow(TraceLabel);
+    const FGitHubRequestHandle Handle = SupersedeSlot.IsEmpty() ? FGitHubRequestHandle() : BeginSupersedingRequest(SupersedeSlot, Request);
+    Request->OnProcessRequestComplete().BindLambda([this, Callback, Flow, Handle](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bWasSuccessful)
+        {
+            Flow->MarkStage(TEXT("Completed"));
 
-    Request->SetContentAsString(RequestBody);
+            // A newer query in the same slot owns the result, this one is not even decoded
+            if (!RequestTracker->IsCurrent(Handle))
+            {
+                Flow->MarkStage(TEXT("Superseded"));
+                return;
+            }
 
-    Request->OnProcessRequestComplete().BindLambda([this, Callback](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bWasSuccessful)
-        {
-            if (bWasSuccessful && ResponsePtr->GetResponseCode() == 200)
+            if (!bWasSuccessful || !ResponsePtr.IsValid() || ResponsePtr->GetResponseCode() != 200)
             {
-                TSharedPtr<FJsonObject> ResponseObject;
-                TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponsePtr->GetContentAsString());
+                LogHttpError(ResponsePtr);
+
+                // Query handlers get a null object on failure so multi-step fetches can finish, on the same
+                // kind of thread as a response so they marshal both outcomes back the same way
+                RunOnWorkerThread(Flow, [Callback]() { Callback(nullptr); });
+                return;
+            }
 
-                if (FJsonSerializer::Deserialize(Reader, ResponseObject))
+            // Inflate and parse off the game thread, handlers marshal their results back themselves
+            RunOnWorkerThread(Flow, [this, Callback, ResponsePtr, Handle]()
                 {
-                    if (ResponseObject->HasField("errors"))
+                    if (!RequestTracker->IsCurrent(Handle))
                     {
-                        const TArray<TSharedPtr<FJsonValue>>& Errors = ResponseObject->GetArrayField("errors");
-                        for (const TSharedPtr<FJsonValue>& ErrorValue : Errors)
-                        {
-                            TSharedPtr<FJsonObject> ErrorObject = ErrorValue->AsObject();
-                            FString Message = ErrorObject->GetStringField("message");
-                            UE_LOG(LogTemp, Error, TEXT("GraphQL Fehler: %s"), *Message);
-                        }
                         return;
                     }
 
+                    TSharedPtr<FJsonObject> ResponseObject = DeserializeGraphQLResponse(ResponsePtr);
+
+                    GITHUB_TRACE_SCOPE(GitHub_HandleResponse);
                     Callback(ResponseObject);
+                });
+        });
+
+    DispatchRequest(Request);
+}
+
+void UGitHubAPIManager::SendPagedQuery(const FString& Shape, const TArray<FString>& ConnectionPath, TFunction<FString(int32)> BuildQuery, TFunction<void(TSharedPtr<FJsonObject>)> Callback, const TCHAR* TraceLabel, const FGitHubRequestHandle& LoadHandle, const FGitHubCancellationTokenPtr& Token, EGitHubRequestPriority Priority)
+{
+    const int32 PageSize = PageSizer->GetPageSize(Shape);
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateGraphQLRequest(BuildQuery(PageSize));
+
+    // The response and a cancel race for the callback, only the first one gets through
+    TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe> bHandled = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+
+    // Sizing is tuned with the settings of the moment the page was asked for
+    const double TargetSeconds = ConnectionSettings.TargetPageSeconds;
+    const int32 MaxCost = ConnectionSettings.MaxPageCost;
+
+    // GitHub refused the page as too large, ask for the same page in two halves' worth
+    auto RetrySmaller = [this, Shape, ConnectionPath, BuildQuery, Callback, TraceLabel, LoadHandle, Token, Priority, PageSize]()
+        {
+            const int32 SmallerSize = PageSizer->ReportOversized(Shape, PageSize);
+            if (SmallerSize <= 0)
+            {
+                UE_LOG(LogTemp, Error, TEXT("%s page cannot be split any further."), *Shape);
+                Callback(nullptr);
+                return;
+            }
+
+            UE_LOG(LogTemp, Warning, TEXT("%s page of %d was too large for GitHub, retrying with %d."), *Shape, PageSize, SmallerSize);
+            RunOnGameThread([this, Shape, ConnectionPath, BuildQuery, Callback, TraceLabel, LoadHandle, Token, Priority]()
+                {
+                    SendPagedQuery(Shape, ConnectionPath, BuildQuery, Callback, TraceLabel, LoadHandle, Token, Priority);
+                });
+        };
+
+    // Every page of a load runs under the handle taken when the load began, so a later page never supersedes a newer load
+    const FGitHubRequestHandle Handle = LoadHandle;
+    if (Handle.IsSet() && !RequestTracker->Attach(Handle, Request))
+    {
+        return;
+    }
+
+    FDelegateHandle CancelHandle;
+    if (Token.IsValid())
+    {
+        TWeakPtr<FGitHubConnectionPool, ESPMode::ThreadSafe> WeakPool = ConnectionPool;
+        CancelHandle = Token->AddCancelHandler([Request, WeakPool, Callback, bHandled]()
+            {
+                if (bHandled->exchange(true))
+                {
+                    return;
                 }
-                else
+
+                if (TSharedPtr<FGitHubConnectionPool, ESPMode::ThreadSafe> Pool = WeakPool.Pin())
                 {
-                    UE_LOG(LogTemp, Error, TEXT("Fehler beim Deserialisieren der JSON-Antwort."));
+                    Pool->Cancel(Request);
                 }
+                Callback(nullptr);
+            });
+    }
+
+    FGitHubTraceFlowPtr Flow = GitHubTrace::BeginFlow(TraceLabel);
+    TWeakPtr<FGitHubCancellationToken, ESPMode::ThreadSafe> WeakToken = Token;
+    Request->OnProcessRequestComplete().BindLambda([this, Shape, ConnectionPath, Callback, Flow, Handle, PageSize, TargetSeconds, MaxCost, bHandled, RetrySmaller, WeakToken, CancelHandle](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bWasSuccessful)
+        {
+            Flow->MarkStage(TEXT("Completed"));
+
+            // Other requests of the same chain may still be running, only this one's handler is done
+            if (FGitHubCancellationTokenPtr PinnedToken = WeakToken.Pin())
+            {
+                PinnedToken->RemoveCancelHandler(CancelHandle);
             }
-            else
+
+            if (!RequestTracker->IsCurrent(Handle))
+            {
+                Flow->MarkStage(TEXT("Superseded"));
+                return;
+            }
+
+            if (bHandled->exchange(true))
+            {
+                return;
+            }
+
+            GitHubTrace::FFlowScope FlowScope(Flow);
+            const int32 ResponseCode = bWasSuccessful && ResponsePtr.IsValid() ? ResponsePtr->GetResponseCode() : 0;
+
+            // GitHub answers queries it could not finish in time with 502 or 504
+            if (ResponseCode == 502 || ResponseCode == 504)
+            {
+                RetrySmaller();
+                return;
+            }
+
+            if (ResponseCode != 200)
             {
                 LogHttpError(ResponsePtr);
+                RunOnWorkerThread(Flow, [Callback]() { Callback(nullptr); });
+                return;
             }
+
+            const double Seconds = RequestPtr->GetElapsedTime();
+            RunOnWorkerThread(Flow, [this, Shape, ConnectionPath, Callback, ResponsePtr, Handle, PageSize, TargetSeconds, MaxCost, Seconds, RetrySmaller]()
+                {
+                    if (!RequestTracker->IsCurrent(Handle))
+                    {
+                        return;
+                    }
+
+                    bool bOversized = false;
+                    TSharedPtr<FJsonObject> ResponseObject = DeserializeGraphQLResponse(ResponsePtr, &bOversized);
+                    if (bOversized)
+                    {
+                        RetrySmaller();
+                        return;
+                    }
+
+                    if (ResponseObject.IsValid())
+                    {
+                        PageSizer->ReportPage(Shape, PageSize, CountPageNodes(ResponseObject, ConnectionPath), Seconds, GetQueryCost(ResponseObject), TargetSeconds, MaxCost);
+                    }
+
+                    GITHUB_TRACE_SCOPE(GitHub_HandleResponse);
+                    Callback(ResponseObject);
+                });
         });
 
-    Request->ProcessRequest();
+    if (Token.IsValid() && Token->IsCancelled())
+    {
+        return;
+    }
+
+    DispatchRequest(Request, Priority);
 }
 
-void UGitHubAPIManager::SendGraphQLMutation(const FString& Mutation, const TFunction<void(TSharedPtr<FJsonObject>)>& Callback)
+void UGitHubAPIManager::SendGraphQLMutation(const FString& Mutation, const TFunction<void(TSharedPtr<FJsonObject>)>& Callback, const TCHAR* TraceLabel)
 {
-    FString URL = "https://api.github.com/graphql";
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = Http->CreateRequest();
-    Request->SetURL(URL);
-    Request->SetVerb("POST");
-    Request->SetHeader("Authorization", "Bearer " + AccessToken);
-    Request->SetHeader("User-Agent", "UEGitHubManager");
-    Request->SetHeader("Content-Type", "application/json");
-
-    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-    JsonObject->SetStringField("query", Mutation);
-
-    FString RequestBody;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestBody);
-    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
-    Request->SetContentAsString(RequestBody);
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateGraphQLRequest(Mutation);
 
-    Request->OnProcessRequestComplete().BindLambda([this, Callback](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bWasSuccessful)
+    FGitHubTraceFlowPtr Flow = GitHubTrace::BeginFlow(TraceLabel);
+    Request->OnProcessRequestComplete().BindLambda([this, Callback, Flow](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bWasSuccessful)
         {
-            if (bWasSuccessful && ResponsePtr->GetResponseCode() == 200)
+            Flow->MarkStage(TEXT("Completed"));
+
+            if (!bWasSuccessful || ResponsePtr->GetResponseCode() != 200)
             {
-                TSharedPtr<FJsonObject> ResponseObject;
-                TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponsePtr->GetContentAsString());
-                if (FJsonSerializer::Deserialize(Reader, ResponseObject))
+                LogHttpError(ResponsePtr);
+                GitHubTrace::FFlowScope FlowScope(Flow);
+                RunOnGameThread([this]() { OnMutationCompleted.Broadcast(false); });
+                return;
+            }
+
+            RunOnWorkerThread(Flow, [this, Callback, ResponsePtr]()
                 {
-                    if (ResponseObject->HasField("errors"))
+                    TSharedPtr<FJsonObject> ResponseObject = DeserializeGraphQLResponse(ResponsePtr);
+                    if (!ResponseObject.IsValid())
                     {
-                        const TArray<TSharedPtr<FJsonValue>>& Errors = ResponseObject->GetArrayField("errors");
-                        for (const TSharedPtr<FJsonValue>& ErrorValue : Errors)
-                        {
-                            TSharedPtr<FJsonObject> ErrorObject = ErrorValue->AsObject();
-                            FString Message = ErrorObject->GetStringField("message");
-                            UE_LOG(LogTemp, Error, TEXT("GraphQL Fehler: %s"), *Message);
-                        }
-                        AsyncTask(ENamedThreads::GameThread, [this]() { OnMutationCompleted.Broadcast(false); });
+                        RunOnGameThread([this]() { OnMutationCompleted.Broadcast(false); });
                         return;
                     }
+
+                    GITHUB_TRACE_SCOPE(GitHub_HandleResponse);
                     Callback(ResponseObject);
+                });
+        });
+
+    DispatchRequest(Request);
+}
+
+TGitHubFuture<TSharedPtr<FJsonObject>> UGitHubAPIManager::SendGraphQLAsync(const FString& Document, const TCHAR* TraceLabel, const FGitHubCancellationTokenPtr& Token, EGitHubRequestPriority Priority)
+{
+    TSharedRef<TGitHubPromise<TSharedPtr<FJsonObject>>, ESPMode::ThreadSafe> Promise = MakeShared<TGitHubPromise<TSharedPtr<FJsonObject>>, ESPMode::ThreadSafe>();
+    TGitHubFuture<TSharedPtr<FJsonObject>> Future = Promise->GetFuture();
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateGraphQLRequest(Document);
+
+    FDelegateHandle CancelHandle;
+    if (Token.IsValid())
+    {
+        TWeakPtr<FGitHubConnectionPool, ESPMode::ThreadSafe> WeakPool = ConnectionPool;
+        CancelHandle = Token->AddCancelHandler([Promise, Request, WeakPool]()
+            {
+                if (!Promise->Complete(MakeError(TEXT("Cancelled"))))
+                {
+                    return;
                 }
-                else
+
+                if (TSharedPtr<FGitHubConnectionPool, ESPMode::ThreadSafe> Pool = WeakPool.Pin())
                 {
-                    UE_LOG(LogTemp, Error, TEXT("Fehler beim Deserialisieren der JSON-Antwort."));
-                    AsyncTask(ENamedThreads::GameThread, [this]() { OnMutationCompleted.Broadcast(false); });
+                    Pool->Cancel(Request);
                 }
+            });
+    }
+
+    FGitHubTraceFlowPtr Flow = GitHubTrace::BeginFlow(TraceLabel);
+    TWeakPtr<FGitHubCancellationToken, ESPMode::ThreadSafe> WeakToken = Token;
+    Request->OnProcessRequestComplete().BindLambda([this, Promise, Flow, WeakToken, CancelHandle](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bWasSuccessful)
+        {
+            Flow->MarkStage(TEXT("Completed"));
+
+            // Steps running side by side share the token, only this request's handler is done
+            if (FGitHubCancellationTokenPtr PinnedToken = WeakToken.Pin())
+            {
+                PinnedToken->RemoveCancelHandler(CancelHandle);
             }
-            else
+
+            if (!bWasSuccessful || !ResponsePtr.IsValid() || ResponsePtr->GetResponseCode() != 200)
             {
                 LogHttpError(ResponsePtr);
-                AsyncTask(ENamedThreads::GameThread, [this]() { OnMutationCompleted.Broadcast(false); });
+                Promise->Complete(MakeError(ResponsePtr.IsValid()
+                    ? FString::Printf(TEXT("GitHub answered with HTTP %d."), ResponsePtr->GetResponseCode())
+                    : FString(TEXT("GitHub could not be reached."))));
+                return;
+            }
+
+            // Completed on the worker, so a continuation that sends the next request never waits for a frame
+            RunOnWorkerThread(Flow, [this, Promise, ResponsePtr]()
+                {
+                    TSharedPtr<FJsonObject> ResponseObject = DeserializeGraphQLResponse(ResponsePtr);
+                    if (!ResponseObject.IsValid())
+                    {
+                        Promise->Complete(MakeError(TEXT("GitHub returned errors for the request.")));
+                        return;
+                    }
+
+                    GITHUB_TRACE_SCOPE(GitHub_HandleResponse);
+                    Promise->Complete(MakeValue(ResponseObject));
+                });
+        });
+
+    if (Token.IsValid() && Token->IsCancelled())
+    {
+        return Future;
+    }
+
+    DispatchRequest(Request, Priority);
+    return Future;
+}
+
+TGitHubFuture<FString> UGitHubAPIManager::QueryStringFieldAsync(const FString& Document, const TArray<FString>& ObjectPath, const FString& FieldName, const TCHAR* TraceLabel, const FGitHubCancellationTokenPtr& Token)
+{
+    return SendGraphQLAsync(Document, TraceLabel, Token).Next([this, ObjectPath, FieldName](TGitHubResult<TSharedPtr<FJsonObject>> Response) -> TGitHubResult<FString>
+        {
+            if (Response.HasError())
+            {
+                return MakeError(Response.StealError());
+            }
+
+            TSharedPtr<FJsonObject> Object = Response.GetValue();
+            for (const FString& ObjectField : ObjectPath)
+            {
+                const TSharedPtr<FJsonObject>* Child = nullptr;
+                if (!Object->TryGetObjectField(ObjectField, Child))
+                {
+                    return MakeError(FString::Printf(TEXT("Field '%s' missing in response."), *ObjectField));
+                }
+                Object = *Child;
+            }
+
+            FString Value = GetStringFieldSafe(Object, FieldName);
+            if (Value.IsEmpty())
+            {
+                return MakeError(FString::Printf(TEXT("Field '%s' missing in response."), *FieldName));
             }
+            return MakeValue(MoveTemp(Value));
         });
+}
+
+TGitHubFuture<FString> UGitHubAPIManager::CreateProjectFieldAsync(const FString& ProjectId, const FString& FieldName, const FGitHubCancellationTokenPtr& Token)
+{
+    FString Mutation = FString::Printf(TEXT(
+        "mutation {"
+        "  createProjectV2Field("
+        "    input: {"
+        "      projectId: \"%s\""
+        "      dataType: DATE"
+        "      name: \"%s\""
+        "    }"
+        "  ) {"
+        "    projectV2Field {"
+        "      ... on ProjectV2SingleSelectField {"
+        "        id"
+        "        name"
+        "      }"
+        "      ... on ProjectV2Field {"
+        "        id"
+        "        name"
+        "      }"
+        "    }"
+        "  }"
+        "}"), *ProjectId, *FieldName);
 
-    Request->ProcessRequest();
+    const TCHAR* TraceLabel = FieldName == TEXT("StartDate") ? TEXT("CreateStartDateField") : TEXT("CreateEndDateField");
+    return QueryStringFieldAsync(Mutation, { TEXT("data"), TEXT("createProjectV2Field"), TEXT("projectV2Field") }, TEXT("id"), TraceLabel, Token);
 }
 
 
 void UGitHubAPIManager::CreateNewProject(const FString& Owner, const FString& ProjectName)
 {
-    FString Query = FString::Printf(TEXT("query { user(login: \"%s\") { id } }"), *Owner);
-
-    SendGraphQLQuery(Query, [this, ProjectName](TSharedPtr<FJsonObject> ResponseObject)
+    CreateNewProjectAsync(Owner, ProjectName).Next([this](TGitHubResult<FString> Result)
         {
-            if (!ResponseObject.IsValid() || !ResponseObject->HasField("data"))
+            if (Result.HasError())
             {
-                AsyncTask(ENamedThreads::GameThread, [this]() { OnMutationCompleted.Broadcast(false); });
+                UE_LOG(LogTemp, Error, TEXT("Creating the project failed: %s"), *Result.GetError());
+                RunOnGameThread([this]() { OnMutationCompleted.Broadcast(false); });
                 return;
             }
 
-            FString OwnerId = ResponseObject->GetObjectField("data")
-                ->GetObjectField("user")
-                ->GetStringField("id");
+            RunOnGameThread([this, ProjectId = Result.StealValue()]()
+                {
+                    OnProjectCreated.Broadcast(ProjectId);
+                    OnMutationCompleted.Broadcast(true);
+                });
+        });
+}
+
+TGitHubFuture<FString> UGitHubAPIManager::CreateNewProjectAsync(const FString& Owner, const FString& ProjectName, const FGitHubCancellationTokenPtr& Token)
+{
+    FString OwnerQuery = FString::Printf(TEXT("query { user(login: \"%s\") { id } }"), *Owner);
+    TGitHubFuture<FString> OwnerId = QueryStringFieldAsync(OwnerQuery, { TEXT("data"), TEXT("user") }, TEXT("id"), TEXT("ResolveOwnerId"), Token);
 
+    TGitHubFuture<FString> ProjectId = GitHubAsync::Then<FString>(MoveTemp(OwnerId), [this, ProjectName, Token](const FString& ResolvedOwnerId)
+        {
             FString Mutation = FString::Printf(
                 TEXT("mutation { createProjectV2(input: {title: \"%s\", ownerId: \"%s\"}) { projectV2 { id title url } } }"),
-                *ProjectName, *OwnerId);
+                *ProjectName, *ResolvedOwnerId);
+
+            return QueryStringFieldAsync(Mutation, { TEXT("data"), TEXT("createProjectV2"), TEXT("projectV2") }, TEXT("id"), TEXT("CreateProjectV2"), Token);
+        });
+
+    // Both date fields only need the project, so they are created side by side
+    TGitHubFuture<FString> Created = GitHubAsync::Then<FString>(MoveTemp(ProjectId), [this, Token](const FString& CreatedProjectId)
+        {
+            TArray<TGitHubFuture<FString>> Fields;
+            Fields.Add(CreateProjectFieldAsync(CreatedProjectId, TEXT("StartDate"), Token));
+            Fields.Add(CreateProjectFieldAsync(CreatedProjectId, TEXT("EndDate"), Token));
 
-            SendGraphQLMutation(Mutation, [this](TSharedPtr<FJsonObject> MutationResponse)
+            // The project exists on GitHub either way, a missing date field is reported on its own
+            return GitHubAsync::WhenAll(MoveTemp(Fields)).Next([this, CreatedProjectId, Token](TGitHubResult<TArray<FString>> FieldIds) -> TGitHubResult<FString>
                 {
-                    if (!MutationResponse.IsValid())
+                    if (FieldIds.HasError() && !(Token.IsValid() && Token->IsCancelled()))
                     {
-                        AsyncTask(ENamedThreads::GameThread, [this]() { OnMutationCompleted.Broadcast(false); });
-                        return;
+                        UE_LOG(LogTemp, Warning, TEXT("Project %s was created, but its date fields could not be added: %s"), *CreatedProjectId, *FieldIds.GetError());
+                        RunOnGameThread([this]() { OnMutationCompleted.Broadcast(false); });
                     }
-
-                    FString ProjectId = MutationResponse->GetObjectField("data")
-                        ->GetObjectField("createProjectV2")
-                        ->GetObjectField("projectV2")
-                        ->GetStringField("id");
-
-                    FString StartDateMutation = FString::Printf(TEXT(
-                        "mutation {"
-                        "  createProjectV2Field("
-                        "    input: {"
-                        "      projectId: \"%s\""
-                        "      dataType: DATE"
-                        "      name: \"StartDate\""
-                        "    }"
-                        "  ) {"
-                        "    projectV2Field {"
-                        "      ... on ProjectV2SingleSelectField {"
-                        "        id"
-                        "        name"
-                        "      }"
-                        "      ... on ProjectV2Field {"
-                        "        id"
-                        "        name"
-                        "      }"
-                        "    }"
-                        "  }"
-                        "}"), *ProjectId);
-
-                    SendGraphQLMutation(StartDateMutation, [this, ProjectId](TSharedPtr<FJsonObject> StartDateResponse)
-                        {
-                            FString EndDateMutation = FString::Printf(TEXT(
-                                "mutation {"
-                                "  createProjectV2Field("
-                                "    input: {"
-                                "      projectId: \"%s\""
-                                "      dataType: DATE"
-                                "      name: \"EndDate\""
-                                "    }"
-                                "  ) {"
-                                "    projectV2Field {"
-                                "      ... on ProjectV2SingleSelectField {"
-                                "        id"
-                                "        name"
-                                "      }"
-                                "      ... on ProjectV2Field {"
-                                "        id"
-                                "        name"
-                                "      }"
-                                "    }"
-                                "  }"
-                                "}"), *ProjectId);
-
-                            SendGraphQLMutation(EndDateMutation, [this, ProjectId](TSharedPtr<FJsonObject> EndDateResponse)
-                                {
-                                    AsyncTask(ENamedThreads::GameThread, [this, ProjectId]()
-                                        {
-                                            OnProjectCreated.Broadcast(ProjectId);
-                                            OnMutationCompleted.Broadcast(true);
-                                            FetchUserProjects();
-                                        });
-                                });
-                        });
+                    return MakeValue(CreatedProjectId);
                 });
         });
+
+    return Created.Next([this](TGitHubResult<FString> Result)
+        {
+            if (Result.HasValue())
+            {
+                RunOnGameThread([this]() { FetchUserProjects(); });
+            }
+            return Result;
+        });
 }
 
 void UGitHubAPIManager::FetchUserProjects()
 {
+    // Starting over supersedes a discovery that is still running
+    TSharedPtr<FGitHubProjectDiscovery> Discovery = MakeShared<FGitHubProjectDiscovery>();
+    ActiveDiscovery = Discovery;
+
     FString Query = TEXT(R"(
         query {
             viewer {
-                projectsV2(first: 100) {
+                organizations(first: 100) {
                     nodes {
-                        id
-                        title
-                        url
-                        closed
+                        login
                     }
                 }
             }
         }
     )");
-    SendGraphQLQuery(Query, [this](TSharedPtr<FJsonObject> ResponseObject)
+    SendGraphQLQuery(Query, [this, Discovery](TSharedPtr<FJsonObject> ResponseObject)
         {
-            HandleFetchUserProjectsResponse(ResponseObject);
-        });
+            // The viewer's own projects are always a source, organizations are added if they could be listed
+            TArray<FString> Owners;
+            Owners.Add(FString());
+
+            const TSharedPtr<FJsonObject>* DataObject;
+            const TSharedPtr<FJsonObject>* ViewerObject;
+            const TSharedPtr<FJsonObject>* OrganizationsObject;
+            const TArray<TSharedPtr<FJsonValue>>* OrganizationNodes;
+            if (ResponseObject.IsValid()
+                && ResponseObject->TryGetObjectField("data", DataObject)
+                && (*DataObject)->TryGetObjectField("viewer", ViewerObject)
+                && (*ViewerObject)->TryGetObjectField("organizations", OrganizationsObject)
+                && (*OrganizationsObject)->TryGetArrayField("nodes", OrganizationNodes))
+            {
+                for (const TSharedPtr<FJsonValue>& OrganizationValue : *OrganizationNodes)
+                {
+                    FString Login = GetStringFieldSafe(OrganizationValue->AsObject(), "login");
+                    if (!Login.IsEmpty())
+                    {
+                        Owners.Add(Login);
+                    }
+                }
+            }
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Organizations could not be listed, only the viewer's projects are discovered."));
+            }
+
+            RunOnGameThread([this, Discovery, Owners]()
+                {
+                    if (ActiveDiscovery != Discovery)
+                    {
+                        return;
+                    }
+
+                    Discovery->PendingOwners = Owners;
+                    PumpProjectDiscovery(Discovery);
+                });
+        }, TEXT("DiscoverProjectOwners"));
+}
+
+void UGitHubAPIManager::PumpProjectDiscovery(TSharedPtr<FGitHubProjectDiscovery> Discovery)
+{
+    while (Discovery->ActiveOwners < FMath::Max(1, MaxConcurrentProjectSources) && Discovery->PendingOwners.Num() > 0)
+    {
+        FString Owner = Discovery->PendingOwners[0];
+        Discovery->PendingOwners.RemoveAt(0);
+        Discovery->ActiveOwners++;
+
+        FetchProjectSourcePage(Discovery, Owner, FString());
+    }
+
+    if (Discovery->ActiveOwners == 0 && Discovery->PendingOwners.Num() == 0)
+    {
+        ActiveDiscovery.Reset();
+        PublishDiscoveredProjects(Discovery, true);
+    }
+}
+
+void UGitHubAPIManager::FetchProjectSourcePage(TSharedPtr<FGitHubProjectDiscovery> Discovery, const FString& Owner, const FString& Cursor)
+{
+    const FString After = Cursor.IsEmpty() ? FString() : FString::Printf(TEXT(", after: \"%s\""), *Cursor);
+    auto BuildQuery = [Owner, After](int32 PageSize)
+        {
+            const FString Connection = FString::Printf(TEXT(
+                "projectsV2(first: %d%s) { "
+                "  nodes { "
+                "    id "
+                "    title "
+                "    url "
+                "    closed "
+                "    owner { "
+                "      ... on User { login } "
+                "      ... on Organization { login } "
+                "    } "
+                "  } "
+                "  pageInfo { hasNextPage endCursor } "
+                "}"), PageSize, *After);
+
+            // An empty owner stands for the viewer
+            return Owner.IsEmpty()
+                ? FString::Printf(TEXT("query { viewer { %s } rateLimit { cost } }"), *Connection)
+                : FString::Printf(TEXT("query { organization(login: \"%s\") { %s } rateLimit { cost } }"), *Owner, *Connection);
+        };
+
+    const TArray<FString> ConnectionPath = { TEXT("data"), Owner.IsEmpty() ? TEXT("viewer") : TEXT("organization"), TEXT("projectsV2") };
+    SendPagedQuery(TEXT("Projects"), ConnectionPath, BuildQuery, [this, Discovery, Owner](TSharedPtr<FJsonObject> ResponseObject)
+        {
+            TArray<FProjectInfo> Projects;
+            FString NextCursor;
+            if (!HandleFetchUserProjectsResponse(ResponseObject, Owner.IsEmpty() ? TEXT("viewer") : TEXT("organization"), Projects, NextCursor))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Projects of '%s' could not be loaded."), Owner.IsEmpty() ? TEXT("viewer") : *Owner);
+            }
+
+            RunOnGameThread([this, Discovery, Owner, Projects = MoveTemp(Projects), NextCursor]()
+                {
+                    if (ActiveDiscovery != Discovery)
+                    {
+                        return;
+                    }
+
+                    for (const FProjectInfo& ProjectInfo : Projects)
+                    {
+                        if (!Discovery->ProjectsById.Contains(ProjectInfo.ProjectId))
+                        {
+                            Discovery->ProjectOrder.Add(ProjectInfo.ProjectId);
+                        }
+                        Discovery->ProjectsById.Add(ProjectInfo.ProjectId, ProjectInfo);
+                    }
+
+                    if (!NextCursor.IsEmpty())
+                    {
+                        FetchProjectSourcePage(Discovery, Owner, NextCursor);
+                        return;
+                    }
+
+                    // The last source is published once, as the completed list
+                    Discovery->ActiveOwners--;
+                    if (Discovery->ActiveOwners > 0 || Discovery->PendingOwners.Num() > 0)
+                    {
+                        PublishDiscoveredProjects(Discovery, false);
+                    }
+                    PumpProjectDiscovery(Discovery);
+                });
+        }, TEXT("FetchUserProjects"));
 }
 
-void UGitHubAPIManager::HandleFetchUserProjectsResponse(TSharedPtr<FJsonObject> ResponseObject)
+bool UGitHubAPIManager::HandleFetchUserProjectsResponse(TSharedPtr<FJsonObject> ResponseObject, const FString& OwnerField, TArray<FProjectInfo>& OutProjects, FString& OutNextCursor)
 {
+    GITHUB_TRACE_SCOPE(GitHub_ParseUserProjects);
+
     if (!ResponseObject.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("Ungltige Antwort vom Server."));
-        return;
+        return false;
     }
 
     TSharedPtr<FJsonObject> DataObject = ResponseObject->GetObjectField("data");
     if (!DataObject.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("Fehler beim Parsen des Datenobjekts."));
-        return;
+        return false;
     }
 
-    TSharedPtr<FJsonObject> ViewerObject = DataObject->GetObjectField("viewer");
-    if (!ViewerObject.IsValid())
+    TSharedPtr<FJsonObject> OwnerObject = DataObject->GetObjectField(OwnerField);
+    if (!OwnerObject.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("Viewer-Daten nicht gefunden."));
-        return;
+        return false;
     }
 
-    TSharedPtr<FJsonObject> ProjectsObject = ViewerObject->GetObjectField("projectsV2");
+    TSharedPtr<FJsonObject> ProjectsObject = OwnerObject->GetObjectField("projectsV2");
     if (!ProjectsObject.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("ProjectsV2-Daten nicht gefunden."));
-        return;
+        return false;
     }
 
     const TArray<TSharedPtr<FJsonValue>>* ProjectsArray;
-    if (ProjectsObject->TryGetArrayField("nodes", ProjectsArray))
+    if (!ProjectsObject->TryGetArrayField("nodes", ProjectsArray))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Keine Projekte gefunden."));
+        return false;
+    }
+
+    for (const TSharedPtr<FJsonValue>& ProjectValue : *ProjectsArray)
     {
-        TArray<FProjectInfo> ProjectsList;
-        UserProjects.Empty();
+        TSharedPtr<FJsonObject> ProjectObject = ProjectValue->AsObject();
 
-        for (const TSharedPtr<FJsonValue>& ProjectValue : *ProjectsArray)
-        {
-            TSharedPtr<FJsonObject> ProjectObject = ProjectValue->AsObject();
+        bool bIsClosed = false;
+        ProjectObject->TryGetBoolField("closed", bIsClosed);
 
-            bool bIsClosed = false;
-            ProjectObject->TryGetBoolField("closed", bIsClosed);
+        if (!bIsClosed)
+        {
+            FProjectInfo ProjectInfo;
+            ProjectInfo.ProjectId = GetStringFieldSafe(ProjectObject, "id");
+            ProjectInfo.ProjectTitle = GetStringFieldSafe(ProjectObject, "title");
+            ProjectInfo.ProjectURL = GetStringFieldSafe(ProjectObject, "url");
 
-            if (!bIsClosed)
+            const TSharedPtr<FJsonObject>* ProjectOwnerObject;
+            if (ProjectObject->TryGetObjectField("owner", ProjectOwnerObject))
             {
-                FProjectInfo ProjectInfo;
-                ProjectInfo.ProjectId = GetStringFieldSafe(ProjectObject, "id");
-                ProjectInfo.ProjectTitle = GetStringFieldSafe(ProjectObject, "title");
-                ProjectInfo.ProjectURL = GetStringFieldSafe(ProjectObject, "url");
-                ProjectsList.Add(ProjectInfo);
-                UserProjects.Add(ProjectInfo.ProjectTitle, ProjectInfo);
+                ProjectInfo.OwnerLogin = GetStringFieldSafe(*ProjectOwnerObject, "login");
             }
-        }
 
-        AsyncTask(ENamedThreads::GameThread, [this, ProjectsList]()
-            {
-                OnUserProjectsLoaded.Broadcast(ProjectsList);
-            });
+            OutProjects.Add(ProjectInfo);
+        }
     }
-    else
+
+    const TSharedPtr<FJsonObject>* PageInfoObject;
+    bool bHasNextPage = false;
+    if (ProjectsObject->TryGetObjectField("pageInfo", PageInfoObject) && (*PageInfoObject)->TryGetBoolField("hasNextPage", bHasNextPage) && bHasNextPage)
     {
-        UE_LOG(LogTemp, Error, TEXT("Keine Projekte gefunden."));
+        OutNextCursor = GetStringFieldSafe(*PageInfoObject, "endCursor");
     }
+
+    return true;
+}
+
+void UGitHubAPIManager::PublishDiscoveredProjects(TSharedPtr<FGitHubProjectDiscovery> Discovery, bool bComplete)
+{
+    TSharedRef<TArray<FProjectInfo>, ESPMode::ThreadSafe> Snapshot = MakeShared<TArray<FProjectInfo>, ESPMode::ThreadSafe>();
+    TArray<FProjectInfo>& ProjectsList = *Snapshot;
+    ProjectsList.Reserve(Discovery->ProjectOrder.Num());
+    for (const FString& ProjectId : Discovery->ProjectOrder)
+    {
+        ProjectsList.Add(Discovery->ProjectsById[ProjectId]);
+    }
+
+    StateStore->Update([&Discovery, &ProjectsList, &Snapshot, bComplete](FGitHubManagerState& State)
+        {
+            // While sources are still loading, projects from the previous run stay reachable by title
+            if (bComplete)
+            {
+                State.UserProjects.Reset();
+            }
+
+            for (const FProjectInfo& ProjectInfo : ProjectsList)
+            {
+                const FProjectInfo* Existing = State.UserProjects.Find(ProjectInfo.ProjectTitle);
+                if (Existing && Existing->ProjectId != ProjectInfo.ProjectId && Discovery->ProjectsById.Contains(Existing->ProjectId))
+                {
+                    // Same title in two owners, the second one is reachable as "Owner/Title"
+                    State.UserProjects.Add(ProjectInfo.OwnerLogin / ProjectInfo.ProjectTitle, ProjectInfo);
+                }
+                else
+                {
+                    State.UserProjects.Add(ProjectInfo.ProjectTitle, ProjectInfo);
+                }
+            }
+            State.ProjectList = Snapshot;
+        });
+
+    FGitHubProjectListHandle Handle;
+    Handle.Snapshot = Snapshot;
+    OnProjectListPublished.Broadcast(Handle);
+
+    if (OnUserProjectsLoaded.IsBound())
+    {
+        OnUserProjectsLoaded.Broadcast(ProjectsList);
+    }
+
+    if (bComplete)
+    {
+        OnProjectDiscoveryCompleted.Broadcast(ProjectsList.Num());
+    }
+
+    SchedulePrefetch(ProjectsList);
+}
+
+void UGitHubAPIManager::FetchProjectDetails(const FString& ProjectName)
+{
+    const FGitHubStateSnapshot State = StateStore->Read();
+    const FProjectInfo* Project = State->UserProjects.Find(ProjectName);
+    if (!Project)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Project with name '%s' not found."), *ProjectName);
+        return;
+    }
+
+    const FString ProjectId = Project->ProjectId;
+    RecordProjectOpen(ProjectId);
+
+    if (!ShowCachedBoard(ProjectId).IsValid())
+    {
+        RequestProjectDetails(ProjectId, false);
+    }
+}
+
+TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> UGitHubAPIManager::ShowCachedBoard(const FString& ProjectId)
+{
+    // A board loaded in the background or evicted to disk is shown right away and only brought up to date afterwards
+    TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Cached;
+    if (!PrefetchedBoards.RemoveAndCopyValue(ProjectId, Cached))
+    {
+        Cached = RestoreBoard(ProjectId);
+    }
+
+    if (!Cached.IsValid())
+    {
+        return nullptr;
+    }
+
+    // Like a cold load it supersedes the one still in flight, which would otherwise replace it once it lands
+    BeginSupersedingLoad(TEXT("ProjectDetails"));
+    PublishProjectDetails(Cached.ToSharedRef(), false);
+    RequestProjectDetails(ProjectId, true);
+    return LoadedBoards.FindRef(ProjectId);
+}
+
+void UGitHubAPIManager::RefreshProjectDetails(const FString& ProjectName)
+{
+    const FGitHubStateSnapshot State = StateStore->Read();
+    const FProjectInfo* Project = State->UserProjects.Find(ProjectName);
+    if (!Project)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Project with name '%s' not found."), *ProjectName);
+        return;
+    }
+
+    RequestProjectDetails(Project->ProjectId, true);
+}
+
+void UGitHubAPIManager::RequestProjectDetails(const FString& ProjectId, bool bIncremental)
+{
+    // Clicking through projects only shows the last one, background refreshes replace older refreshes of the same project
+    const FString Slot = bIncremental ? FString::Printf(TEXT("ProjectRefresh/%s"), *ProjectId) : FString(TEXT("ProjectDetails"));
+    const FGitHubRequestHandle LoadHandle = BeginSupersedingLoad(Slot);
+    FetchBoardPage(ProjectId, nullptr, FString(), LoadHandle, nullptr, EGitHubRequestPriority::Normal, [this, bIncremental, LoadHandle](TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Board)
+        {
+            if (Board.IsValid())
+            {
+                // The board is handed over as one shared snapshot instead of being copied into every listener
+                RunOnGameThread([this, bIncremental, LoadHandle, Board = Board.ToSharedRef()]()
+                    {
+                        // A newer load may have begun while this one was resolved and queued
+                        if (RequestTracker->IsCurrent(LoadHandle))
+                        {
+                            PublishProjectDetails(Board, bIncremental);
+                        }
+                    });
+            }
+        });
+}
+
+TGitHubFuture<FGitHubBoardHandle> UGitHubAPIManager::FetchProjectDetailsAsync(const FString& ProjectId, const FGitHubCancellationTokenPtr& Token)
+{
+    TSharedRef<TGitHubPromise<FGitHubBoardHandle>, ESPMode::ThreadSafe> Promise = MakeShared<TGitHubPromise<FGitHubBoardHandle>, ESPMode::ThreadSafe>();
+    RunOnGameThread([this, ProjectId, Token, Promise]()
+        {
+            RecordProjectOpen(ProjectId);
+
+            // Opens the same cached boards as FetchProjectDetails, the caller gets the one on screen right away
+            if (TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Cached = ShowCachedBoard(ProjectId))
+            {
+                FGitHubBoardHandle Handle;
+                Handle.Snapshot = Cached;
+                Promise->Complete(MakeValue(MoveTemp(Handle)));
+                return;
+            }
+
+            // The last project opened either way wins. The pages are not tied to the slot, so a superseded load still
+            // answers its caller, it just does not publish.
+            const FGitHubRequestHandle LoadHandle = BeginSupersedingLoad(TEXT("ProjectDetails"));
+            FetchBoardPage(ProjectId, nullptr, FString(), FGitHubRequestHandle(), Token, EGitHubRequestPriority::Normal, [this, Promise, Token, LoadHandle](TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Board)
+                {
+                    if (Token.IsValid() && Token->IsCancelled())
+                    {
+                        Promise->Complete(MakeError(TEXT("Cancelled")));
+                        return;
+                    }
+
+                    if (!Board.IsValid())
+                    {
+                        Promise->Complete(MakeError(TEXT("Project could not be loaded.")));
+                        return;
+                    }
+
+                    // Published like a refresh, boards already on screen only see what changed. The caller gets the board
+                    // once publishing filled in content that could not be looked up.
+                    RunOnGameThread([this, Promise, LoadHandle, Board = Board.ToSharedRef()]()
+                        {
+                            if (!RequestTracker->IsCurrent(LoadHandle))
+                            {
+                                Promise->Complete(MakeError(TEXT("Superseded")));
+                                return;
+                            }
+
+                            PublishProjectDetails(Board, true);
+
+                            FGitHubBoardHandle Handle;
+                            Handle.Snapshot = Board;
+                            Promise->Complete(MakeValue(MoveTemp(Handle)));
+                        });
+                });
+        });
+
+    return Promise->GetFuture();
+}
+
+bool UGitHubAPIManager::IsProjectPrefetched(const FString& ProjectId) const
+{
+    return PrefetchedBoards.Contains(ProjectId);
+}
+
+void UGitHubAPIManager::FetchDashboard(const TArray<FString>& ProjectIds)
+{
+    TArray<FString> Projects = ProjectIds;
+    if (Projects.Num() == 0)
+    {
+        const FGitHubStateSnapshot State = StateStore->Read();
+        if (State->ProjectList.IsValid())
+        {
+            for (const FProjectInfo& Project : *State->ProjectList)
+            {
+                Projects.Add(Project.ProjectId);
+            }
+        }
+    }
+
+    // Starting over supersedes a run that is still counting
+    TSharedPtr<FGitHubDashboardRun> Run = MakeShared<FGitHubDashboardRun>();
+    ActiveDashboardRun = Run;
+    Dashboard->SetProjects(Projects);
+
+    for (const FString& ProjectId : Projects)
+    {
+        // A loaded board is counted as it is and kept current through its own updates
+        if (const TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* Board = LoadedBoards.Find(ProjectId))
+        {
+            Dashboard->SetProjectCounts(FGitHubDashboard::CountBoard(**Board));
+        }
+        else
+        {
+            Run->PendingProjects.Add(ProjectId);
+        }
+    }
+
+    ScheduleDashboardBroadcast();
+    PumpDashboard(Run);
+}
+
+FGitHubDashboardSummary UGitHubAPIManager::GetDashboardSummary() const
+{
+    return Dashboard->GetSummary();
+}
+
+void UGitHubAPIManager::PumpDashboard(TSharedPtr<FGitHubDashboardRun> Run)
+{
+    while (Run->ActiveProjects < FMath::Max(1, MaxConcurrentDashboardProjects) && Run->PendingProjects.Num() > 0)
+    {
+        const FString ProjectId = Run->PendingProjects[0];
+        Run->PendingProjects.RemoveAt(0);
+        Run->ActiveProjects++;
+
+        TSharedRef<FGitHubProjectCounts, ESPMode::ThreadSafe> Counts = MakeShared<FGitHubProjectCounts, ESPMode::ThreadSafe>();
+        Counts->ProjectId = ProjectId;
+        FetchDashboardPage(Run, ProjectId, Counts, FString());
+    }
+
+    if (Run->ActiveProjects == 0 && Run->PendingProjects.Num() == 0 && ActiveDashboardRun == Run)
+    {
+        ActiveDashboardRun.Reset();
+    }
+}
+
+void UGitHubAPIManager::FetchDashboardPage(TSharedPtr<FGitHubDashboardRun> Run, const FString& ProjectId, TSharedRef<FGitHubProjectCounts, ESPMode::ThreadSafe> Counts, const FString& Cursor)
+{
+    SendPagedQuery(TEXT("ProjectCounts"), { TEXT("data"), TEXT("node"), TEXT("items") }, [ProjectId, Cursor](int32 PageSize)
+        {
+            return MakeProjectCountsQuery(ProjectId, PageSize, Cursor);
+        },
+        [this, Run, ProjectId, Counts](TSharedPtr<FJsonObject> ResponseObject)
+        {
+            // The next page is only asked for from the game thread, so no two responses ever add to Counts at once
+            FString NextCursor;
+            const bool bParsed = ParseDashboardPage(ResponseObject, *Counts, NextCursor);
+            if (!bParsed)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Items of project %s could not be counted."), *ProjectId);
+            }
+            Counts->bComplete = bParsed && NextCursor.IsEmpty();
+
+            RunOnGameThread([this, Run, ProjectId, Counts, NextCursor, bParsed]()
+                {
+                    if (ActiveDashboardRun != Run)
+                    {
+                        return;
+                    }
+
+                    // Pages show up as they are counted, unless the board was loaded meanwhile and counted from its items
+                    if (!LoadedBoards.Contains(ProjectId))
+                    {
+                        Dashboard->SetProjectCounts(*Counts);
+                        ScheduleDashboardBroadcast();
+                    }
+
+                    if (bParsed && !NextCursor.IsEmpty())
+                    {
+                        FetchDashboardPage(Run, ProjectId, Counts, NextCursor);
+                        return;
+                    }
+
+                    Run->ActiveProjects--;
+                    PumpDashboard(Run);
+                });
+        }, TEXT("FetchDashboard"));
+}
+
+bool UGitHubAPIManager::ParseDashboardPage(TSharedPtr<FJsonObject> ResponseObject, FGitHubProjectCounts& InOutCounts, FString& OutNextCursor)
+{
+    GITHUB_TRACE_SCOPE(GitHub_ParseDashboardPage);
+
+    const TSharedPtr<FJsonObject>* DataObject = nullptr;
+    const TSharedPtr<FJsonObject>* NodeObject = nullptr;
+    const TSharedPtr<FJsonObject>* ItemsObject = nullptr;
+    const TArray<TSharedPtr<FJsonValue>>* Nodes = nullptr;
+    if (!ResponseObject.IsValid() || !ResponseObject->TryGetObjectField(TEXT("data"), DataObject)
+        || !(*DataObject)->TryGetObjectField(TEXT("node"), NodeObject)
+        || !(*NodeObject)->TryGetObjectField(TEXT("items"), ItemsObject)
+        || !(*ItemsObject)->TryGetArrayField(TEXT("nodes"), Nodes))
+    {
+        return false;
+    }
+
+    InOutCounts.ProjectTitle = GetStringFieldSafe(*NodeObject, "title");
+    for (const TSharedPtr<FJsonValue>& Node : *Nodes)
+    {
+        const TSharedPtr<FJsonObject>* ItemObject = nullptr;
+        if (!Node->TryGetObject(ItemObject))
+        {
+            continue;
+        }
+
+        const TSharedPtr<FJsonObject>* StatusObject = nullptr;
+        const FString ColumnName = (*ItemObject)->TryGetObjectField(TEXT("fieldValueByName"), StatusObject) ? GetStringFieldSafe(*StatusObject, "name") : FString();
+
+        // The same states the entity cache keeps for full boards
+        FString State;
+        const TSharedPtr<FJsonObject>* ContentObject = nullptr;
+        if ((*ItemObject)->TryGetObjectField(TEXT("content"), ContentObject))
+        {
+            const FString TypeName = GetStringFieldSafe(*ContentObject, "__typename");
+            if (TypeName == TEXT("Issue"))
+            {
+                State = GetStringFieldSafe(*ContentObject, "issueState");
+            }
+            else if (TypeName == TEXT("PullRequest"))
+            {
+                State = GetStringFieldSafe(*ContentObject, "pullRequestState");
+            }
+            else if (TypeName == TEXT("DraftIssue"))
+            {
+                State = TEXT("DRAFT");
+            }
+        }
+
+        FGitHubDashboard::AddItem(InOutCounts, ColumnName, State);
+    }
+
+    const TSharedPtr<FJsonObject>* PageInfoObject = nullptr;
+    bool bHasNextPage = false;
+    if ((*ItemsObject)->TryGetObjectField(TEXT("pageInfo"), PageInfoObject) && (*PageInfoObject)->TryGetBoolField(TEXT("hasNextPage"), bHasNextPage) && bHasNextPage)
+    {
+        OutNextCursor = GetStringFieldSafe(*PageInfoObject, "endCursor");
+    }
+    return true;
+}
+
+void UGitHubAPIManager::UpdateDashboardFromBoard(const FProjectInfo& Board)
+{
+    if (Dashboard->Contains(Board.ProjectId))
+    {
+        Dashboard->SetProjectCounts(FGitHubDashboard::CountBoard(Board));
+        ScheduleDashboardBroadcast();
+    }
+}
+
+void UGitHubAPIManager::ScheduleDashboardBroadcast()
+{
+    // However many boards changed during this frame, listeners get one summary on the next tick
+    if (!DashboardBroadcastHandle.IsValid())
+    {
+        DashboardBroadcastHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+            {
+                DashboardBroadcastHandle.Reset();
+                if (OnDashboardUpdated.IsBound())
+                {
+                    OnDashboardUpdated.Broadcast(Dashboard->GetSummary());
+                }
+                return false;
+            }), 0.0f);
+    }
+}
+
+FGitHubBoardMetrics UGitHubAPIManager::GetBoardMetrics(const FString& ProjectId) const
+{
+    if (const TSharedPtr<FGitHubBoardAnalytics>* Analytics = BoardAnalytics.Find(ProjectId))
+    {
+        return (*Analytics)->GetMetrics();
+    }
+
+    FGitHubBoardMetrics Metrics;
+    Metrics.ProjectId = ProjectId;
+    return Metrics;
+}
+
+void UGitHubAPIManager::UpdateBoardAnalytics(const FProjectInfo& Board, const FGitHubBoardDiff* Diff)
+{
+    GITHUB_TRACE_SCOPE(GitHub_UpdateBoardAnalytics);
+
+    const FDateTime Now = FDateTime::UtcNow();
+    TSharedPtr<FGitHubBoardAnalytics>& Analytics = BoardAnalytics.FindOrAdd(Board.ProjectId);
+    if (!Analytics.IsValid())
+    {
+        Analytics = MakeShared<FGitHubBoardAnalytics>();
+        Diff = nullptr;
+    }
+
+    if (!Diff)
+    {
+        Analytics->SyncBoard(Board, Now);
+        return;
+    }
+
+    // Items the diff does not name are unchanged, their records stay as they are
+    for (const FString& ItemId : Diff->Removed)
+    {
+        Analytics->RemoveItem(ItemId);
+    }
+    for (int32 Index : Diff->Added)
+    {
+        Analytics->UpdateItem(Board.Items[Index], Now);
+    }
+    for (int32 Index : Diff->Changed)
+    {
+        Analytics->UpdateItem(Board.Items[Index], Now);
+    }
+    for (const FGitHubBoardDiff::FMove& Move : Diff->Moved)
+    {
+        Analytics->UpdateItem(Board.Items[Move.ItemIndex], Now);
+    }
+}
+
+bool UGitHubAPIManager::GetBoardAtTime(const FString& ProjectId, const FDateTime& Time, FProjectInfo& OutBoard)
+{
+    TArray<FProjectItem> Items;
+    if (!EventLog->Reconstruct(ProjectId, Time, Items))
+    {
+        return false;
+    }
+
+    OutBoard = FProjectInfo();
+    OutBoard.ProjectId = ProjectId;
+
+    // The log only knows ColumnIds, names and fields come from the board as it is now
+    if (const TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* Board = LoadedBoards.Find(ProjectId))
+    {
+        OutBoard.ProjectTitle = (*Board)->ProjectTitle;
+        OutBoard.ProjectURL = (*Board)->ProjectURL;
+        OutBoard.OwnerLogin = (*Board)->OwnerLogin;
+        OutBoard.ColumnFieldId = (*Board)->ColumnFieldId;
+        OutBoard.StartDateFieldId = (*Board)->StartDateFieldId;
+        OutBoard.EndDateFieldId = (*Board)->EndDateFieldId;
+        OutBoard.Columns = (*Board)->Columns;
+    }
+
+    for (FProjectItem& Item : Items)
+    {
+        if (const FColumnInfo* Column = OutBoard.Columns.FindByPredicate([&Item](const FColumnInfo& Candidate) { return Candidate.ColumnId == Item.ColumnId; }))
+        {
+            Item.ColumnName = Column->ColumnName;
+        }
+        Item.StartDateFieldId = OutBoard.StartDateFieldId;
+        Item.EndDateFieldId = OutBoard.EndDateFieldId;
+        Item.StartDateTime = ParseProjectDate(Item.StartDate);
+        Item.EndDateTime = ParseProjectDate(Item.EndDate);
+    }
+    OutBoard.Items = MoveTemp(Items);
+    return true;
+}
+
+void UGitHubAPIManager::RecordBoardHistory(const FProjectInfo& Board, const FGitHubBoardDiff* Diff)
+{
+    GITHUB_TRACE_SCOPE(GitHub_RecordBoardHistory);
+
+    const FDateTime Now = FDateTime::UtcNow();
+    if (!Diff)
+    {
+        EventLog->SyncBoard(Board, Now);
+    }
+    else
+    {
+        for (const FString& ItemId : Diff->Removed)
+        {
+            EventLog->RemoveItem(Board.ProjectId, ItemId, Now);
+        }
+        for (int32 Index : Diff->Added)
+        {
+            EventLog->UpdateItem(Board.ProjectId, Board.Items[Index], Now);
+        }
+        for (int32 Index : Diff->Changed)
+        {
+            EventLog->UpdateItem(Board.ProjectId, Board.Items[Index], Now);
+        }
+        for (const FGitHubBoardDiff::FMove& Move : Diff->Moved)
+        {
+            EventLog->UpdateItem(Board.ProjectId, Board.Items[Move.ItemIndex], Now);
+        }
+    }
+
+    ScheduleEventLogFlush();
+}
+
+void UGitHubAPIManager::ScheduleEventLogFlush()
+{
+    // Events reach the disk at most once a second, reading the history writes the rest right away
+    if (!EventLogFlushHandle.IsValid() && EventLog->HasPendingEvents())
+    {
+        EventLogFlushHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+            {
+                EventLogFlushHandle.Reset();
+                EventLog->Flush();
+                return false;
+            }), 1.0f);
+    }
+}
+
+void UGitHubAPIManager::RecordProjectOpen(const FString& ProjectId)
+{
+    UsageHistory->RecordOpen(ProjectId, FDateTime::UtcNow(), PrefetchSettings.HistoryHalfLifeDays);
+
+    // The user got there first, the regular load takes over
+    if (PrefetchingProjectId == ProjectId)
+    {
+        PrefetchToken->Cancel();
+        PrefetchToken.Reset();
+        PrefetchingProjectId.Reset();
+    }
+    PrefetchQueue.Remove(ProjectId);
+    PumpPrefetch();
+}
+
+void UGitHubAPIManager::SchedulePrefetch(const TArray<FProjectInfo>& Projects)
+{
+    if (!PrefetchSettings.bEnabled || PrefetchSettings.MaxProjects <= 0)
+    {
+        return;
+    }
+
+    TArray<FString> Candidates;
+    Candidates.Reserve(Projects.Num());
+    for (const FProjectInfo& Project : Projects)
+    {
+        Candidates.Add(Project.ProjectId);
+    }
+
+    // Boards already on screen or ready count against MaxProjects, only the rest is queued
+    PrefetchQueue.Reset();
+    for (const FString& ProjectId : UsageHistory->Rank(Candidates, PrefetchSettings.MaxProjects, FDateTime::UtcNow(), PrefetchSettings.HistoryHalfLifeDays))
+    {
+        if (!LoadedBoards.Contains(ProjectId) && !BoardCache->IsSpilled(ProjectId) && !PrefetchedBoards.Contains(ProjectId) && ProjectId != PrefetchingProjectId)
+        {
+            PrefetchQueue.Add(ProjectId);
+        }
+    }
+
+    PumpPrefetch();
+}
+
+void UGitHubAPIManager::PumpPrefetch()
+{
+    // One board at a time, prefetching should never compete with itself for connections
+    if (!PrefetchingProjectId.IsEmpty() || PrefetchQueue.Num() == 0)
+    {
+        return;
+    }
+
+    if (!HasPrefetchBudget())
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("Prefetch budget used up, %d boards are loaded on demand."), PrefetchQueue.Num());
+        PrefetchQueue.Reset();
+        return;
+    }
+
+    PrefetchingProjectId = PrefetchQueue[0];
+    PrefetchQueue.RemoveAt(0);
+    PrefetchToken = FGitHubCancellationToken::Create();
+
+    FetchBoardPage(PrefetchingProjectId, nullptr, FString(), FGitHubRequestHandle(), PrefetchToken, EGitHubRequestPriority::Background, [this, Token = PrefetchToken](TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Board)
+        {
+            RunOnGameThread([this, Token, Board]()
+                {
+                    // A cancelled prefetch was replaced by a regular load or another prefetch
+                    if (Token->IsCancelled())
+                    {
+                        return;
+                    }
+
+                    if (Board.IsValid() && !LoadedBoards.Contains(Board->ProjectId))
+                    {
+                        PrefetchedBoards.Add(Board->ProjectId, Board);
+                    }
+
+                    PrefetchingProjectId.Reset();
+                    PrefetchToken.Reset();
+                    PumpPrefetch();
+                });
+        });
+}
+
+bool UGitHubAPIManager::HasPrefetchBudget() const
+{
+    const FGitHubConnectionStats Stats = ConnectionPool->GetStats();
+    if (Stats.BackgroundBytes >= int64(PrefetchSettings.MaxMegabytes * 1024.0f * 1024.0f))
+    {
+        return false;
+    }
+
+    // Before the first response the window is unknown, the first prefetch then finds out
+    return Stats.RateLimitLimit <= 0 || Stats.RateLimitRemaining >= Stats.RateLimitLimit * PrefetchSettings.RateLimitReserve;
+}
+
+void UGitHubAPIManager::FetchBoardPage(const FString& ProjectId, TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Board, const FString& Cursor, const FGitHubRequestHandle& LoadHandle, const FGitHubCancellationTokenPtr& Token, EGitHubRequestPriority Priority, TFunction<void(TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>)> OnLoaded)
+{
+    SendPagedQuery(TEXT("ProjectItems"), { TEXT("data"), TEXT("node"), TEXT("items") }, [ProjectId, Cursor](int32 PageSize)
+        {
+            return MakeProjectDetailsQuery(ProjectId, PageSize, Cursor);
+        },
+        [this, ProjectId, Board, LoadHandle, Token, Priority, OnLoaded](TSharedPtr<FJsonObject> ResponseObject)
+        {
+            FString NextCursor;
+            TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Page = ParseProjectDetails(ResponseObject, NextCursor);
+            if (!Page.IsValid())
+            {
+                // A board missing its later pages would read as items removed from it, the partial load is dropped
+                if (Board.IsValid())
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("Items of project %s could only be loaded in part, the board is left as it was."), *ProjectId);
+                }
+                OnLoaded(nullptr);
+                return;
+            }
+
+            if (Board.IsValid())
+            {
+                Board->Items.Append(MoveTemp(Page->Items));
+                Page = Board;
+            }
+
+            if (NextCursor.IsEmpty())
+            {
+                ResolveBoardContent(Page.ToSharedRef(), Token, Priority, OnLoaded);
+                return;
+            }
+
+            // A load superseded meanwhile asks for no more pages
+            if (!RequestTracker->IsCurrent(LoadHandle))
+            {
+                return;
+            }
+
+            FetchBoardPage(ProjectId, Page, NextCursor, LoadHandle, Token, Priority, OnLoaded);
+        }, TEXT("FetchProjectDetails"), LoadHandle, Token, Priority);
+}
+
+void UGitHubAPIManager::ResolveBoardContent(TSharedRef<FProjectInfo, ESPMode::ThreadSafe> Board, const FGitHubCancellationTokenPtr& Token, EGitHubRequestPriority Priority, TFunction<void(TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>)> OnResolved)
+{
+    // Content cached in the version the board references is not downloaded again. Every entity the board needs is
+    // held from here on, so a prune while the rest is downloaded cannot take it away.
+    TSharedRef<TMap<FString, FGitHubContentEntityRef>, ESPMode::ThreadSafe> Entities = MakeShared<TMap<FString, FGitHubContentEntityRef>, ESPMode::ThreadSafe>();
+    TArray<FString> StaleIds;
+    TSet<FString> Requested;
+    for (const FProjectItem& Item : Board->Items)
+    {
+        bool bAlreadyRequested = false;
+        if (Item.ContentId.IsEmpty())
+        {
+            continue;
+        }
+
+        Requested.Add(Item.ContentId, &bAlreadyRequested);
+        if (bAlreadyRequested)
+        {
+            continue;
+        }
+
+        // An outdated version still beats an empty card if the download fails
+        if (TSharedPtr<const FGitHubContentEntity, ESPMode::ThreadSafe> Cached = EntityCache->Find(Item.ContentId))
+        {
+            Entities->Add(Item.ContentId, Cached.ToSharedRef());
+        }
+        if (!EntityCache->IsFresh(Item.ContentId, Item.UpdatedAt))
+        {
+            StaleIds.Add(Item.ContentId);
+        }
+    }
+
+    FetchContentEntities(StaleIds, 0, Token, Priority, Entities, MakeShared<TSet<FString>, ESPMode::ThreadSafe>(), [this, Board, Entities, OnResolved](const TSet<FString>& ChangedIds)
+        {
+            for (FProjectItem& Item : Board->Items)
+            {
+                const FGitHubContentEntityRef* Entity = Entities->Find(Item.ContentId);
+                if (Entity)
+                {
+                    FGitHubEntityCache::ApplyTo(**Entity, Item);
+                }
+                Item.bContentMissing = !Entity && !Item.ContentId.IsEmpty();
+                Item.ContentHash = GitHubBoardDiff::HashItemContent(Item);
+            }
+
+            if (ChangedIds.Num() > 0)
+            {
+                RunOnGameThread([this, ChangedIds, ProjectId = Board->ProjectId]()
+                    {
+                        PropagateEntityChanges(ChangedIds, ProjectId);
+                    });
+            }
+
+            OnResolved(Board);
+        });
+}
+
+void UGitHubAPIManager::FetchContentEntities(const TArray<FString>& Ids, int32 FirstIndex, const FGitHubCancellationTokenPtr& Token, EGitHubRequestPriority Priority, TSharedRef<TMap<FString, FGitHubContentEntityRef>, ESPMode::ThreadSafe> Entities, TSharedRef<TSet<FString>, ESPMode::ThreadSafe> ChangedIds, TFunction<void(const TSet<FString>&)> OnFetched)
+{
+    if (FirstIndex >= Ids.Num() || (Token.IsValid() && Token->IsCancelled()))
+    {
+        OnFetched(*ChangedIds);
+        return;
+    }
+
+    const int32 Count = FMath::Min(MaxNodesPerLookup, Ids.Num() - FirstIndex);
+    FString IdList;
+    for (int32 Index = FirstIndex; Index < FirstIndex + Count; ++Index)
+    {
+        IdList += FString::Printf(TEXT("\"%s\" "), *Ids[Index]);
+    }
+
+    const FString Query = FString::Printf(TEXT("query { nodes(ids: [%s]) { %s } }"), *IdList, ContentSelection);
+    SendGraphQLAsync(Query, TEXT("FetchContentEntities"), Token, Priority).Next([this, Ids, FirstIndex, Count, Token, Priority, Entities, ChangedIds, OnFetched](TGitHubResult<TSharedPtr<FJsonObject>> Response)
+        {
+            const TSharedPtr<FJsonObject>* DataObject = nullptr;
+            const TArray<TSharedPtr<FJsonValue>>* Nodes = nullptr;
+            if (Response.HasValue() && Response.GetValue()->TryGetObjectField(TEXT("data"), DataObject) && (*DataObject)->TryGetArrayField(TEXT("nodes"), Nodes))
+            {
+                for (const TSharedPtr<FJsonValue>& NodeValue : *Nodes)
+                {
+                    // Deleted content comes back as null
+                    const TSharedPtr<FJsonObject>* NodeObject = nullptr;
+                    TSharedRef<FGitHubContentEntity, ESPMode::ThreadSafe> Entity = MakeShared<FGitHubContentEntity, ESPMode::ThreadSafe>();
+                    if (NodeValue->TryGetObject(NodeObject) && ParseContentEntity(*NodeObject, *Entity))
+                    {
+                        Entities->Add(Entity->Id, Entity);
+                        if (EntityCache->Upsert(Entity))
+                        {
+                            ChangedIds->Add(Entity->Id);
+                        }
+                    }
+                }
+            }
+            else
+            {
+                // Items keep whatever content is cached, the next refresh asks again
+                UE_LOG(LogTemp, Warning, TEXT("Content of %d items could not be loaded: %s"), Count, Response.HasError() ? *Response.GetError() : TEXT("unexpected response"));
+            }
+
+            FetchContentEntities(Ids, FirstIndex + Count, Token, Priority, Entities, ChangedIds, OnFetched);
+        });
+}
+
+bool UGitHubAPIManager::ParseContentEntity(TSharedPtr<FJsonObject> ContentObject, FGitHubContentEntity& OutEntity)
+{
+    OutEntity.Id = GetStringFieldSafe(ContentObject, "id");
+    if (OutEntity.Id.IsEmpty())
+    {
+        return false;
+    }
+
+    OutEntity.Type = GetStringFieldSafe(ContentObject, "__typename");
+    OutEntity.Title = GetStringFieldSafe(ContentObject, "title");
+    OutEntity.CreatedAt = GetStringFieldSafe(ContentObject, "createdAt");
+    OutEntity.UpdatedAt = GetStringFieldSafe(ContentObject, "updatedAt");
+    OutEntity.Body = GetStringFieldSafe(ContentObject, "body");
+
+    if (OutEntity.Type == "Issue")
+    {
+        OutEntity.Url = GetStringFieldSafe(ContentObject, "url");
+        OutEntity.State = GetStringFieldSafe(ContentObject, "issueState");
+    }
+    else if (OutEntity.Type == "PullRequest")
+    {
+        OutEntity.Url = GetStringFieldSafe(ContentObject, "url");
+        OutEntity.State = GetStringFieldSafe(ContentObject, "pullRequestState");
+    }
+    else if (OutEntity.Type == "DraftIssue")
+    {
+        OutEntity.State = "DRAFT";
+        OutEntity.Url = "";
+    }
+    return true;
+}
+
+void UGitHubAPIManager::PropagateEntityChanges(const TSet<FString>& ContentIds, const FString& SourceProjectId)
+{
+    // Other loaded boards showing the same issue or pull request pick up its new content right away
+    TArray<TPair<FString, FString>> Affected;
+    for (const TPair<FString, TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>>& Loaded : LoadedBoards)
+    {
+        if (Loaded.Key == SourceProjectId)
+        {
+            continue;
+        }
+
+        for (const FProjectItem& Item : Loaded.Value->Items)
+        {
+            if (ContentIds.Contains(Item.ContentId))
+            {
+                Affected.Emplace(Loaded.Key, Item.ItemId);
+            }
+        }
+    }
+
+    for (const TPair<FString, FString>& Entry : Affected)
+    {
+        UpdateLoadedItem(Entry.Key, Entry.Value, [this](FProjectItem& Item)
+            {
+                if (TSharedPtr<const FGitHubContentEntity, ESPMode::ThreadSafe> Entity = EntityCache->Find(Item.ContentId))
+                {
+                    FGitHubEntityCache::ApplyTo(*Entity, Item);
+                }
+            });
+    }
+}
+
+void UGitHubAPIManager::KeepPreviousContent(const FProjectInfo& PreviousBoard, FProjectInfo& Board)
+{
+    TMap<FString, const FProjectItem*> PreviousItems;
+    for (FProjectItem& Item : Board.Items)
+    {
+        if (!Item.bContentMissing)
+        {
+            continue;
+        }
+
+        if (PreviousItems.Num() == 0)
+        {
+            PreviousItems.Reserve(PreviousBoard.Items.Num());
+            for (const FProjectItem& PreviousItem : PreviousBoard.Items)
+            {
+                PreviousItems.Add(PreviousItem.ItemId, &PreviousItem);
+            }
+        }
+
+        // The UpdatedAt of the previous content stays too, so the next refresh asks for the content again
+        const FProjectItem* const* PreviousItem = PreviousItems.Find(Item.ItemId);
+        if (PreviousItem && !(*PreviousItem)->bContentMissing)
+        {
+            KeepContent(**PreviousItem, Item);
+            Item.ContentHash = GitHubBoardDiff::HashItemContent(Item);
+        }
+    }
+}
+
+void UGitHubAPIManager::PruneEntityCache()
+{
+    // Boards on disk carry their own content, only boards in memory keep entities alive
+    TSet<FString> Referenced;
+    auto Collect = [&Referenced](const TMap<FString, TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>>& Boards)
+        {
+            for (const TPair<FString, TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>>& Board : Boards)
+            {
+                for (const FProjectItem& Item : Board.Value->Items)
+                {
+                    Referenced.Add(Item.ContentId);
+                }
+            }
+        };
+    Collect(LoadedBoards);
+    Collect(PrefetchedBoards);
+
+    EntityCache->Prune([&Referenced](const FString& Id) { return Referenced.Contains(Id); });
+}
+
+TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> UGitHubAPIManager::ParseProjectDetails(TSharedPtr<FJsonObject> ResponseObject, FString& OutNextCursor)
+{
+    GITHUB_TRACE_SCOPE(GitHub_ParseProjectDetails);
+
+    if (!ResponseObject.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Invalid response from server."));
+        return nullptr;
+    }
+
+    TSharedPtr<FJsonObject> DataObject = ResponseObject->GetObjectField("data");
+    if (!DataObject.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Error parsing data object."));
+        return nullptr;
+    }
+
+    TSharedPtr<FJsonObject> NodeObject = DataObject->GetObjectField("node");
+    if (!NodeObject.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Project node not found."));
+        return nullptr;
+    }
+
+    FProjectInfo ProjectInfo;
+    ProjectInfo.ProjectId = GetStringFieldSafe(NodeObject, "id");
+    ProjectInfo.ProjectTitle = GetStringFieldSafe(NodeObject, "title");
+    ProjectInfo.ProjectURL = GetStringFieldSafe(NodeObject, "url");
+
+    // Get field IDs first
+    FString startDateFieldId;
+    FString endDateFieldId;
+
+    // Spalten und Felder verarbeiten
+    if (TSharedPtr<FJsonObject> FieldsObject = NodeObject->GetObjectField("fields"))
+    {
+        const TArray<TSharedPtr<FJsonValue>>* FieldNodes;
+        if (FieldsObject->TryGetArrayField("nodes", FieldNodes))
+        {
+            for (const TSharedPtr<FJsonValue>& FieldValue : *FieldNodes)
+            {
+                TSharedPtr<FJsonObject> FieldObject = FieldValue->AsObject();
+                if (!FieldObject.IsValid()) continue;
+
+                FString FieldName = GetStringFieldSafe(FieldObject, "name");
+                FString FieldId = GetStringFieldSafe(FieldObject, "id");
+
+                if (FieldName == "Status")
+                {
+                    ProjectInfo.ColumnFieldId = FieldId;
+
+                    // Status-Optionen (Spalten) extrahieren
+                    const TArray<TSharedPtr<FJsonValue>>* Options;
+                    if (FieldObject->TryGetArrayField("options", Options))
+                    {
+                        for (const TSharedPtr<FJsonValue>& OptionValue : *Options)
+                        {
+                            TSharedPtr<FJsonObject> OptionObject = OptionValue->AsObject();
+                            FColumnInfo ColumnInfo;
+                            ColumnInfo.ColumnId = GetStringFieldSafe(OptionObject, "id");
+                            ColumnInfo.ColumnName = GetStringFieldSafe(OptionObject, "name");
+                            ProjectInfo.Columns.Add(ColumnInfo);
+                        }
+                    }
+                }
+                else if (FieldName == "StartDate")
+                {
+                    startDateFieldId = FieldId;
+                }
+                else if (FieldName == "EndDate")
+                {
+                    endDateFieldId = FieldId;
+                }
+            }
+        }
+    }
+
+    ProjectInfo.StartDateFieldId = startDateFieldId;
+    ProjectInfo.EndDateFieldId = endDateFieldId;
+
+    TSharedPtr<FJsonObject> ItemsObject = NodeObject->GetObjectField("items");
+    if (!ItemsObject.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Items object is invalid."));
+        return MakeShared<FProjectInfo, ESPMode::ThreadSafe>(MoveTemp(ProjectInfo));
+    }
+
+    const TSharedPtr<FJsonObject>* PageInfoObject;
+    bool bHasNextPage = false;
+    if (ItemsObject->TryGetObjectField("pageInfo", PageInfoObject) && (*PageInfoObject)->TryGetBoolField("hasNextPage", bHasNextPage) && bHasNextPage)
+    {
+        OutNextCursor = GetStringFieldSafe(*PageInfoObject, "endCursor");
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* ItemsArray;
+    if (!ItemsObject->TryGetArrayField("nodes", ItemsArray))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Error retrieving items array."));
+        return MakeShared<FProjectInfo, ESPMode::ThreadSafe>(MoveTemp(ProjectInfo));
+    }
+
+    for (const TSharedPtr<FJsonValue>& ItemValue : *ItemsArray)
+    {
+        TSharedPtr<FJsonObject> ItemObject = ItemValue->AsObject();
+        if (!ItemObject.IsValid())
+        {
+            continue;
+        }
+
+        FProjectItem ProjectItem;
+        if (ParseProjectItem(ItemObject, startDateFieldId, endDateFieldId, ProjectItem))
+        {
+            ProjectInfo.Items.Add(MoveTemp(ProjectItem));
+        }
+    }
+
+    return MakeShared<FProjectInfo, ESPMode::ThreadSafe>(MoveTemp(ProjectInfo));
+}
+
+bool UGitHubAPIManager::ParseProjectItem(TSharedPtr<FJsonObject> ItemObject, const FString& StartDateFieldId, const FString& EndDateFieldId, FProjectItem& OutItem)
+{
+    OutItem.ItemId = GetStringFieldSafe(ItemObject, "id");
+    if (OutItem.ItemId.IsEmpty())
+    {
+        return false;
+    }
+
+    // Set field IDs regardless of whether dates exist
+    OutItem.StartDateFieldId = StartDateFieldId;
+    OutItem.EndDateFieldId = EndDateFieldId;
+
+    if (ItemObject->HasTypedField<EJson::Object>("fieldValues"))
+    {
+        TSharedPtr<FJsonObject> FieldValuesObject = ItemObject->GetObjectField("fieldValues");
+        const TArray<TSharedPtr<FJsonValue>>* FieldValuesNodes;
+        if (FieldValuesObject->TryGetArrayField("nodes", FieldValuesNodes))
+        {
+            for (const TSharedPtr<FJsonValue>& FieldValue : *FieldValuesNodes)
+            {
+                TSharedPtr<FJsonObject> FieldValueObject = FieldValue->AsObject();
+                if (!FieldValueObject.IsValid())
+                {
+                    continue;
+                }
+
+                if (FieldValueObject->HasField("name") && FieldValueObject->HasField("field"))
+                {
+                    FString Name = GetStringFieldSafe(FieldValueObject, "name");
+                    TSharedPtr<FJsonObject> FieldObject = FieldValueObject->GetObjectField("field");
+                    if (FieldObject.IsValid())
+                    {
+                        FString FieldName = GetStringFieldSafe(FieldObject, "name");
+                        FString FieldId = GetStringFieldSafe(FieldObject, "id");
+
+                        if (FieldName == "Status")
+                        {
+                            OutItem.ColumnName = Name;
+                            FString OptionId = GetStringFieldSafe(FieldValueObject, "optionId");
+                            OutItem.ColumnId = OptionId;
+                        }
+                    }
+                }
+
+                if (FieldValueObject->HasField("date") && FieldValueObject->HasField("field"))
+                {
+                    FString DateValue = GetStringFieldSafe(FieldValueObject, "date");
+                    TSharedPtr<FJsonObject> FieldObject = FieldValueObject->GetObjectField("field");
+                    if (FieldObject.IsValid())
+                    {
+                        FString FieldName = GetStringFieldSafe(FieldObject, "name");
+
+                        if (FieldName == "StartDate")
+                        {
+                            OutItem.StartDate = DateValue;
+                        }
+                        else if (FieldName == "EndDate")
+                        {
+                            OutItem.EndDate = DateValue;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Only a reference to the content comes with the board, ResolveBoardContent fills in the rest
+    if (ItemObject->HasTypedField<EJson::Object>("content"))
+    {
+        TSharedPtr<FJsonObject> ContentObject = ItemObject->GetObjectField("content");
+        if (ContentObject.IsValid())
+        {
+            OutItem.Type = GetStringFieldSafe(ContentObject, "__typename");
+            OutItem.ContentId = GetStringFieldSafe(ContentObject, "id");
+            OutItem.UpdatedAt = GetStringFieldSafe(ContentObject, "updatedAt");
+        }
+    }
+
+    OutItem.StartDateTime = ParseProjectDate(OutItem.StartDate);
+    OutItem.EndDateTime = ParseProjectDate(OutItem.EndDate);
+    return true;
+}
+
+void UGitHubAPIManager::PublishProjectDetails(const TSharedRef<FProjectInfo, ESPMode::ThreadSafe>& Board, bool bIncremental)
+{
+    const FProjectInfo& ProjectInfo = *Board;
+
+    // A refresh of an evicted board is compared against its copy on disk, a full load makes that copy useless
+    if (!LoadedBoards.Contains(ProjectInfo.ProjectId))
+    {
+        if (bIncremental)
+        {
+            RestoreBoard(ProjectInfo.ProjectId);
+        }
+        else
+        {
+            BoardCache->Discard(ProjectInfo.ProjectId);
+        }
+    }
+
+    FGitHubBoardDiff Diff;
+    const TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* PreviousBoard = LoadedBoards.Find(ProjectInfo.ProjectId);
+    if (PreviousBoard)
+    {
+        KeepPreviousContent(**PreviousBoard, *Board);
+    }
+    // Item events only describe a board whose columns stay the same and whose items all reached the listeners,
+    // anything else is a full load
+    if (bIncremental && PreviousBoard && !ItemDelivery->IsActive(ProjectInfo.ProjectId) && GitHubBoardDiff::HaveSameColumns(**PreviousBoard, ProjectInfo))
+    {
+        GITHUB_TRACE_SCOPE(GitHub_DiffProjectItems);
+
+        GitHubBoardDiff::Compute(**PreviousBoard, ProjectInfo, Diff);
+        if (Diff.IsEmpty())
+        {
+            // Nothing for the indices or the UI to do, the previous snapshot stays current
+            return;
+        }
+    }
+    else
+    {
+        bIncremental = false;
+    }
+
+    // Items that left the board may have been the last ones showing their content
+    const bool bItemsLeft = PreviousBoard && (!bIncremental || Diff.Removed.Num() > 0);
+
+    IndexBoard(ProjectInfo);
+    LoadedBoards.Add(ProjectInfo.ProjectId, Board);
+    PrefetchedBoards.Remove(ProjectInfo.ProjectId);
+    if (bItemsLeft)
+    {
+        PruneEntityCache();
+    }
+
+    // The board just published is the most recently used one and always stays
+    TrackBoardFootprint(ProjectInfo.ProjectId);
+    EnforceBoardBudget();
+    UpdateDashboardFromBoard(ProjectInfo);
+    UpdateBoardAnalytics(ProjectInfo, bIncremental ? &Diff : nullptr);
+    RecordBoardHistory(ProjectInfo, bIncremental ? &Diff : nullptr);
+
+    FGitHubBoardHandle Handle;
+    Handle.Snapshot = Board;
+    OnProjectBoardPublished.Broadcast(Handle);
+
+    if (bIncremental)
+    {
+        if (Diff.Removed.Num() > 0)
+        {
+            OnItemsRemoved.Broadcast(ProjectInfo.ProjectId, Diff.Removed);
+        }
+
+        if (Diff.Added.Num() > 0)
+        {
+            TArray<FProjectItem> AddedItems;
+            AddedItems.Reserve(Diff.Added.Num());
+            for (int32 Index : Diff.Added)
+            {
+                AddedItems.Add(ProjectInfo.Items[Index]);
+            }
+            OnItemsAdded.Broadcast(ProjectInfo.ProjectId, AddedItems);
+        }
+
+        if (Diff.Changed.Num() > 0)
+        {
+            TArray<FProjectItem> ChangedItems;
+            ChangedItems.Reserve(Diff.Changed.Num());
+            for (int32 Index : Diff.Changed)
+            {
+                ChangedItems.Add(ProjectInfo.Items[Index]);
+            }
+            OnItemsChanged.Broadcast(ProjectInfo.ProjectId, ChangedItems);
+        }
+
+        for (const FGitHubBoardDiff::FMove& Move : Diff.Moved)
+        {
+            const FProjectItem& Item = ProjectInfo.Items[Move.ItemIndex];
+            OnItemMoved.Broadcast(ProjectInfo.ProjectId, Item, Move.FromColumnId, Item.ColumnId);
+        }
+
+        // Listeners that only know the whole board still get it, the item events spare the others a rebuild
+        if (OnProjectDetailsLoaded.IsBound())
+        {
+            OnProjectDetailsLoaded.Broadcast(ProjectInfo);
+        }
+        return;
+    }
+
+    // Thousands of cards in one broadcast means thousands of widgets in one frame. The columns go out first so
+    // the board can be laid out, the items follow a chunk per frame.
+    if (DeliveryBudgetMs > 0.0f && ProjectInfo.Items.Num() > 0)
+    {
+        if (OnProjectDetailsLoaded.IsBound())
+        {
+            FProjectInfo Columns;
+            Columns.ProjectId = ProjectInfo.ProjectId;
+            Columns.ProjectTitle = ProjectInfo.ProjectTitle;
+            Columns.ProjectDescription = ProjectInfo.ProjectDescription;
+            Columns.ProjectURL = ProjectInfo.ProjectURL;
+            Columns.OwnerLogin = ProjectInfo.OwnerLogin;
+            Columns.ColumnFieldId = ProjectInfo.ColumnFieldId;
+            Columns.StartDateFieldId = ProjectInfo.StartDateFieldId;
+            Columns.EndDateFieldId = ProjectInfo.EndDateFieldId;
+            Columns.Columns = ProjectInfo.Columns;
+            OnProjectDetailsLoaded.Broadcast(Columns);
+        }
+
+        StartItemDelivery(ProjectInfo);
+        return;
+    }
+
+    ItemDelivery->Cancel(ProjectInfo.ProjectId);
+    if (OnProjectDetailsLoaded.IsBound())
+    {
+        OnProjectDetailsLoaded.Broadcast(ProjectInfo);
+    }
+    OnBoardDeliveryCompleted.Broadcast(ProjectInfo.ProjectId, ProjectInfo.Items.Num());
 }
 
-void UGitHubAPIManager::FetchProjectDetails(const FString& ProjectName)
+void UGitHubAPIManager::UpdateLoadedItem(const FString& ProjectId, const FString& ItemId, TFunctionRef<void(FProjectItem&)> Mutation)
 {
-    if (!UserProjects.Contains(ProjectName))
+    TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* Board = FindOrRestoreBoard(ProjectId);
+    if (!Board)
+    {
+        return;
+    }
+
+    const int32 ItemIndex = (*Board)->Items.IndexOfByPredicate([&ItemId](const FProjectItem& Candidate) { return Candidate.ItemId == ItemId; });
+    if (ItemIndex == INDEX_NONE)
     {
-        UE_LOG(LogTemp, Error, TEXT("Project with name '%s' not found."), *ProjectName);
         return;
     }
 
-    FString ProjectId = UserProjects[ProjectName].ProjectId;
+    // Published snapshots stay untouched, the board is only modified in place while nobody else holds it
+    if (!Board->IsUnique())
+    {
+        *Board = MakeShared<FProjectInfo, ESPMode::ThreadSafe>(**Board);
+    }
 
-    FString Query = FString::Printf(TEXT(
-        "query { "
-        "  node(id: \"%s\") { "
-        "    ... on ProjectV2 { "
-        "      id "
-        "      title "
-        "      url "
-        "      fields(first: 20) { "
-        "        nodes { "
-        "          ... on ProjectV2Field { "
-        "            id "
-        "            name "
-        "            dataType "
-        "          } "
-        "          ... on ProjectV2SingleSelectField { "
-        "            id "
-        "            name "
-        "            options { "
-        "              id "
-        "              name "
-        "            } "
-        "          } "
-        "        } "
-        "      } "
-        "      items(first: 100) { "
-        "        nodes { "
-        "          id "
-        "          fieldValues(first: 8) { "
-        "            nodes { "
-        "              ... on ProjectV2ItemFieldDateValue { "
-        "                id "
-        "                date "
-        "                field { "
-        "                  ... on ProjectV2Field { "
-        "                    id "
-        "                    name "
-        "                    dataType "
-        "                  } "
-        "                } "
-        "              } "
-        "              ... on ProjectV2ItemFieldSingleSelectValue { "
-        "                id "
-        "                name "
-        "                optionId "
-        "                field { "
-        "                  ... on ProjectV2SingleSelectField { "
-        "                    id "
-        "                    name "
-        "                  } "
-        "                } "
-        "              } "
-        "            } "
-        "          } "
-        "          content { "
-        "            __typename "
-        "            ... on Issue { "
-        "              id "
-        "              title "
-        "              url "
-        "              issueState: state "
-        "              createdAt "
-        "              body "
-        "            } "
-        "            ... on PullRequest { "
-        "              id "
-        "              title "
-        "              url "
-        "              pullRequestState: state "
-        "              createdAt "
-        "              body "
-        "            } "
-        "            ... on DraftIssue { "
-        "              id "
-        "              title "
-        "              body "
-        "              createdAt "
-        "            } "
-        "          } "
-        "        } "
-        "      } "
-        "    } "
-        "  } "
-        "}"), *ProjectId);
+    FProjectItem* Item = &(*Board)->Items[ItemIndex];
+    const FString PreviousColumnId = Item->ColumnId;
+    const FString PreviousColumnName = Item->ColumnName;
+    const uint64 PreviousHash = Item->ContentHash;
+
+    Mutation(*Item);
+    Item->ContentHash = GitHubBoardDiff::HashItemContent(*Item);
+
+    if (TSharedPtr<FGitHubSearchIndex>* SearchIndex = SearchIndices.Find(ProjectId))
+    {
+        (*SearchIndex)->UpdateItem(*Item);
+    }
+
+    if (TSharedPtr<FGitHubTimelineIndex>* TimelineIndex = TimelineIndices.Find(ProjectId))
+    {
+        (*TimelineIndex)->UpdateItem(*Item);
+    }
+
+    if (TSharedPtr<FGitHubBoardAnalytics>* Analytics = BoardAnalytics.Find(ProjectId))
+    {
+        (*Analytics)->UpdateItem(*Item, FDateTime::UtcNow());
+    }
+
+    EventLog->UpdateItem(ProjectId, *Item, FDateTime::UtcNow());
+    ScheduleEventLogFlush();
+
+    if (Item->ColumnName != PreviousColumnName && Dashboard->Contains(ProjectId))
+    {
+        Dashboard->MoveItem(ProjectId, PreviousColumnName, Item->ColumnName);
+        ScheduleDashboardBroadcast();
+    }
+
+    // An item not delivered yet goes out in its edited state anyway
+    if (ItemDelivery->IsPending(ProjectId, ItemId))
+    {
+        return;
+    }
+
+    // Local edits show up right away, the refresh that follows them then finds nothing left to report
+    if (Item->ColumnId != PreviousColumnId)
+    {
+        OnItemMoved.Broadcast(ProjectId, *Item, PreviousColumnId, Item->ColumnId);
+    }
+
+    if (Item->ContentHash != PreviousHash)
+    {
+        OnItemsChanged.Broadcast(ProjectId, TArray<FProjectItem>{ *Item });
+    }
+}
+
+TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* UGitHubAPIManager::FindLoadedBoard(const FString& ProjectId)
+{
+    TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* Board = LoadedBoards.Find(ProjectId);
+    if (Board)
+    {
+        BoardCache->Touch(ProjectId);
+    }
+    return Board;
+}
+
+TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* UGitHubAPIManager::FindOrRestoreBoard(const FString& ProjectId)
+{
+    if (!LoadedBoards.Contains(ProjectId) && RestoreBoard(ProjectId).IsValid())
+    {
+        // Changes made while the board was on disk are picked up by a refresh
+        RequestProjectDetails(ProjectId, true);
+    }
+    return FindLoadedBoard(ProjectId);
+}
+
+TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> UGitHubAPIManager::RestoreBoard(const FString& ProjectId)
+{
+    TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Board = BoardCache->Restore(ProjectId);
+    if (Board.IsValid())
+    {
+        IndexBoard(*Board);
+        LoadedBoards.Add(ProjectId, Board);
+        TrackBoardFootprint(ProjectId);
+        EnforceBoardBudget();
+    }
+    return Board;
+}
+
+void UGitHubAPIManager::IndexBoard(const FProjectInfo& Board)
+{
+    GITHUB_TRACE_SCOPE(GitHub_IndexProjectItems);
+
+    TSharedPtr<FGitHubSearchIndex>& SearchIndex = SearchIndices.FindOrAdd(Board.ProjectId);
+    if (!SearchIndex.IsValid())
+    {
+        SearchIndex = MakeShared<FGitHubSearchIndex>();
+    }
+    SearchIndex->SyncItems(Board.Items);
+
+    TSharedPtr<FGitHubTimelineIndex>& TimelineIndex = TimelineIndices.FindOrAdd(Board.ProjectId);
+    if (!TimelineIndex.IsValid())
+    {
+        TimelineIndex = MakeShared<FGitHubTimelineIndex>();
+    }
+    TimelineIndex->SyncItems(Board.Items);
+}
+
+void UGitHubAPIManager::TrackBoardFootprint(const FString& ProjectId)
+{
+    // Measured when a board is published or restored, item edits in between are too small to matter
+    int64 Bytes = FGitHubBoardCache::EstimateFootprint(*LoadedBoards[ProjectId]);
+    if (const TSharedPtr<FGitHubSearchIndex>* SearchIndex = SearchIndices.Find(ProjectId))
+    {
+        Bytes += (*SearchIndex)->GetAllocatedSize();
+    }
+    if (const TSharedPtr<FGitHubTimelineIndex>* TimelineIndex = TimelineIndices.Find(ProjectId))
+    {
+        Bytes += (*TimelineIndex)->GetAllocatedSize();
+    }
+    BoardCache->Touch(ProjectId, Bytes);
+}
+
+void UGitHubAPIManager::EnforceBoardBudget()
+{
+    if (BoardCacheBudgetMegabytes <= 0)
+    {
+        return;
+    }
 
-    SendGraphQLQuery(Query, [this, ProjectName](TSharedPtr<FJsonObject> ResponseObject)
+    // Boards still being delivered or revalidated are needed in memory until that is done
+    const int64 BudgetBytes = int64(BoardCacheBudgetMegabytes) * 1024 * 1024;
+    const TArray<FString> Evictions = BoardCache->SelectEvictions(BudgetBytes, [this](const FString& ProjectId)
         {
-            HandleFetchProjectDetailsResponse(ResponseObject, ProjectName);
+            return ItemDelivery->IsActive(ProjectId) || PendingRevalidation.Contains(ProjectId);
         });
+
+    for (const FString& ProjectId : Evictions)
+    {
+        TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Board;
+        if (LoadedBoards.RemoveAndCopyValue(ProjectId, Board))
+        {
+            SearchIndices.Remove(ProjectId);
+            TimelineIndices.Remove(ProjectId);
+            BoardCache->Remove(ProjectId);
+            BoardCache->Spill(Board.ToSharedRef());
+        }
+    }
+
+    if (Evictions.Num() > 0)
+    {
+        // The spilled copies carry their content, entities no board in memory shows go with the indices
+        PruneEntityCache();
+        UE_LOG(LogTemp, Log, TEXT("%d boards moved to disk, %.1f MB of boards stay in memory."), Evictions.Num(), BoardCache->GetResidentBytes() / (1024.0 * 1024.0));
+    }
 }
 
-void UGitHubAPIManager::HandleFetchProjectDetailsResponse(TSharedPtr<FJsonObject> ResponseObject, const FString& ProjectName)
+FGitHubBoardCacheStats UGitHubAPIManager::GetBoardCacheStats() const
 {
-    if (!ResponseObject.IsValid())
+    FGitHubBoardCacheStats Stats;
+    Stats.ResidentBoards = BoardCache->NumResident();
+    Stats.ResidentBytes = BoardCache->GetResidentBytes();
+    Stats.SpilledBoards = BoardCache->NumSpilled();
+    return Stats;
+}
+
+void UGitHubAPIManager::StartItemDelivery(const FProjectInfo& Board)
+{
+    ItemDelivery->Start(Board);
+    if (DeliveryHandle.IsValid())
     {
-        UE_LOG(LogTemp, Error, TEXT("Invalid response from server."));
         return;
     }
 
-    TSharedPtr<FJsonObject> DataObject = ResponseObject->GetObjectField("data");
-    if (!DataObject.IsValid())
+    // Runs every frame until all started boards are through
+    DeliveryHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+        {
+            GITHUB_TRACE_SCOPE(GitHub_DeliverItems);
+
+            ItemDelivery->Tick(FMath::Max(DeliveryBudgetMs, 0.0f) / 1000.0,
+                [this](const FString& ProjectId) { return LoadedBoards.FindRef(ProjectId); },
+                [this](const FString& ProjectId, const TArray<FProjectItem>& Items) { OnItemsAdded.Broadcast(ProjectId, Items); },
+                [this](const FString& ProjectId, int32 ItemCount) { OnBoardDeliveryCompleted.Broadcast(ProjectId, ItemCount); });
+
+            if (ItemDelivery->IsEmpty())
+            {
+                DeliveryHandle.Reset();
+                return false;
+            }
+            return true;
+        }));
+}
+
+void UGitHubAPIManager::SetVisibleColumns(const FString& ProjectId, const TArray<FString>& ColumnIds)
+{
+    FGitHubItemDelivery::FFocus Focus = ItemDelivery->GetFocus(ProjectId);
+    Focus.ColumnIds = TSet<FString>(ColumnIds);
+
+    const TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* Board = LoadedBoards.Find(ProjectId);
+    ItemDelivery->SetFocus(ProjectId, Focus, Board ? Board->Get() : nullptr);
+}
+
+void UGitHubAPIManager::SetVisibleDateRange(const FString& ProjectId, const FDateTime& From, const FDateTime& To)
+{
+    FGitHubItemDelivery::FFocus Focus = ItemDelivery->GetFocus(ProjectId);
+    Focus.RangeStart = From;
+    Focus.RangeEnd = To;
+
+    const TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* Board = LoadedBoards.Find(ProjectId);
+    ItemDelivery->SetFocus(ProjectId, Focus, Board ? Board->Get() : nullptr);
+}
+
+void UGitHubAPIManager::RevalidateItems(const FString& ProjectId, const TArray<FString>& ItemIds)
+{
+    // Only a loaded board has items to bring up to date
+    if (ItemIds.Num() == 0 || !LoadedBoards.Contains(ProjectId))
     {
-        UE_LOG(LogTemp, Error, TEXT("Error parsing data object."));
         return;
     }
 
-    TSharedPtr<FJsonObject> NodeObject = DataObject->GetObjectField("node");
-    if (!NodeObject.IsValid())
+    PendingRevalidation.FindOrAdd(ProjectId).Append(ItemIds);
+
+    // Everything touched during this frame goes out together on the next tick
+    if (!RevalidationHandle.IsValid())
     {
-        UE_LOG(LogTemp, Error, TEXT("Project node not found."));
-        return;
+        RevalidationHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+            {
+                FlushRevalidation();
+                return false;
+            }), 0.0f);
     }
+}
 
-    FProjectInfo ProjectInfo;
-    ProjectInfo.ProjectId = GetStringFieldSafe(NodeObject, "id");
-    ProjectInfo.ProjectTitle = GetStringFieldSafe(NodeObject, "title");
-    ProjectInfo.ProjectURL = GetStringFieldSafe(NodeObject, "url");
+void UGitHubAPIManager::FlushRevalidation()
+{
+    RevalidationHandle.Reset();
 
-    // Get field IDs first
-    FString startDateFieldId;
-    FString endDateFieldId;
+    TMap<FString, TSet<FString>> Pending = MoveTemp(PendingRevalidation);
+    PendingRevalidation.Reset();
 
-    // Spalten und Felder verarbeiten
-    if (TSharedPtr<FJsonObject> FieldsObject = NodeObject->GetObjectField("fields"))
+    for (const TPair<FString, TSet<FString>>& Entry : Pending)
     {
-        const TArray<TSharedPtr<FJsonValue>>* FieldNodes;
-        if (FieldsObject->TryGetArrayField("nodes", FieldNodes))
+        const TArray<FString> ItemIds = Entry.Value.Array();
+        for (int32 FirstIndex = 0; FirstIndex < ItemIds.Num(); FirstIndex += MaxNodesPerLookup)
         {
-            for (const TSharedPtr<FJsonValue>& FieldValue : *FieldNodes)
-            {
-                TSharedPtr<FJsonObject> FieldObject = FieldValue->AsObject();
-                if (!FieldObject.IsValid()) continue;
+            const int32 Count = FMath::Min(MaxNodesPerLookup, ItemIds.Num() - FirstIndex);
+            FetchRevalidatedItems(Entry.Key, TArray<FString>(ItemIds.GetData() + FirstIndex, Count));
+        }
+    }
+}
 
-                FString FieldName = GetStringFieldSafe(FieldObject, "name");
-                FString FieldId = GetStringFieldSafe(FieldObject, "id");
+void UGitHubAPIManager::FetchRevalidatedItems(const FString& ProjectId, const TArray<FString>& ItemIds)
+{
+    const TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* Board = LoadedBoards.Find(ProjectId);
+    if (!Board)
+    {
+        return;
+    }
 
-                if (FieldName == "Status")
+    const FString StartDateFieldId = (*Board)->StartDateFieldId;
+    const FString EndDateFieldId = (*Board)->EndDateFieldId;
+
+    FString IdList;
+    for (const FString& ItemId : ItemIds)
+    {
+        IdList += FString::Printf(TEXT("\"%s\" "), *ItemId);
+    }
+
+    const FString Query = FString::Printf(TEXT(
+        "query { "
+        "  nodes(ids: [%s]) { "
+        "    ... on ProjectV2Item { "
+        "      project { id } "
+        "      %s "
+        "    } "
+        "  } "
+        "}"), *IdList, ItemSelection);
+
+    SendGraphQLQuery(Query, [this, ProjectId, ItemIds, StartDateFieldId, EndDateFieldId](TSharedPtr<FJsonObject> ResponseObject)
+        {
+            const TSharedPtr<FJsonObject>* DataObject = nullptr;
+            const TArray<TSharedPtr<FJsonValue>>* Nodes = nullptr;
+            if (!ResponseObject.IsValid() || !ResponseObject->TryGetObjectField(TEXT("data"), DataObject) || !(*DataObject)->TryGetArrayField(TEXT("nodes"), Nodes))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Revalidating %d items of project %s failed, reloading the board."), ItemIds.Num(), *ProjectId);
+                RunOnGameThread([this, ProjectId]() { RequestProjectDetails(ProjectId, true); });
+                return;
+            }
+
+            // Nodes come back in the order of the ids, null for items that were deleted
+            TSharedRef<FProjectInfo, ESPMode::ThreadSafe> Fresh = MakeShared<FProjectInfo, ESPMode::ThreadSafe>();
+            Fresh->ProjectId = ProjectId;
+            TArray<FString> GoneItemIds;
+            for (int32 Index = 0; Index < ItemIds.Num(); ++Index)
+            {
+                const TSharedPtr<FJsonObject>* ItemObject = nullptr;
+                const TSharedPtr<FJsonObject>* ProjectObject = nullptr;
+                FProjectItem Item;
+                if (Nodes->IsValidIndex(Index) && (*Nodes)[Index]->TryGetObject(ItemObject)
+                    && (*ItemObject)->TryGetObjectField(TEXT("project"), ProjectObject) && GetStringFieldSafe(*ProjectObject, "id") == ProjectId
+                    && ParseProjectItem(*ItemObject, StartDateFieldId, EndDateFieldId, Item))
                 {
-                    ProjectInfo.ColumnFieldId = FieldId;
+                    Fresh->Items.Add(MoveTemp(Item));
+                }
+                else
+                {
+                    GoneItemIds.Add(ItemIds[Index]);
+                }
+            }
 
-                    // Status-Optionen (Spalten) extrahieren
-                    const TArray<TSharedPtr<FJsonValue>>* Options;
-                    if (FieldObject->TryGetArrayField("options", Options))
-                    {
-                        for (const TSharedPtr<FJsonValue>& OptionValue : *Options)
+            // Content goes through the entity cache exactly like on a full load
+            ResolveBoardContent(Fresh, nullptr, EGitHubRequestPriority::Normal, [this, ProjectId, GoneItemIds](TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Resolved)
+                {
+                    RunOnGameThread([this, ProjectId, GoneItemIds, Resolved]()
                         {
-                            TSharedPtr<FJsonObject> OptionObject = OptionValue->AsObject();
-                            FColumnInfo ColumnInfo;
-                            ColumnInfo.ColumnId = GetStringFieldSafe(OptionObject, "id");
-                            ColumnInfo.ColumnName = GetStringFieldSafe(OptionObject, "name");
-                            ProjectInfo.Columns.Add(ColumnInfo);
-                        }
-                    }
-                }
-                else if (FieldName == "StartDate")
+                            MergeRevalidatedItems(ProjectId, Resolved->Items, GoneItemIds);
+                        });
+                });
+        }, TEXT("RevalidateItems"));
+}
+
+void UGitHubAPIManager::MergeRevalidatedItems(const FString& ProjectId, const TArray<FProjectItem>& FreshItems, const TArray<FString>& GoneItemIds)
+{
+    GITHUB_TRACE_SCOPE(GitHub_MergeRevalidatedItems);
+
+    TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* Board = LoadedBoards.Find(ProjectId);
+    if (!Board)
+    {
+        return;
+    }
+
+    // Published snapshots stay untouched, the board is only modified in place while nobody else holds it
+    if (!Board->IsUnique())
+    {
+        *Board = MakeShared<FProjectInfo, ESPMode::ThreadSafe>(**Board);
+    }
+
+    TArray<FProjectItem>& Items = (*Board)->Items;
+    TSharedPtr<FGitHubSearchIndex>* SearchIndex = SearchIndices.Find(ProjectId);
+    TSharedPtr<FGitHubTimelineIndex>* TimelineIndex = TimelineIndices.Find(ProjectId);
+    TSharedPtr<FGitHubBoardAnalytics>* Analytics = BoardAnalytics.Find(ProjectId);
+    const FDateTime Now = FDateTime::UtcNow();
+
+    TArray<FString> RemovedItemIds;
+    for (const FString& ItemId : GoneItemIds)
+    {
+        if (Items.RemoveAll([&ItemId](const FProjectItem& Candidate) { return Candidate.ItemId == ItemId; }) > 0)
+        {
+            RemovedItemIds.Add(ItemId);
+            if (SearchIndex)
+            {
+                (*SearchIndex)->RemoveItem(ItemId);
+            }
+            if (TimelineIndex)
+            {
+                (*TimelineIndex)->RemoveItem(ItemId);
+            }
+            if (Analytics)
+            {
+                (*Analytics)->RemoveItem(ItemId);
+            }
+            EventLog->RemoveItem(ProjectId, ItemId, Now);
+        }
+    }
+
+    TArray<FProjectItem> AddedItems;
+    TArray<FProjectItem> ChangedItems;
+    TArray<TPair<FProjectItem, FString>> MovedItems;
+    const FString& ColumnFieldId = (*Board)->ColumnFieldId;
+    for (const FProjectItem& FreshItem : FreshItems)
+    {
+        FProjectItem* Existing = Items.FindByPredicate([&FreshItem](const FProjectItem& Candidate) { return Candidate.ItemId == FreshItem.ItemId; });
+        if (!Existing)
+        {
+            Items.Add(FreshItem);
+            AddedItems.Add(FreshItem);
+        }
+        else
+        {
+            // The response may predate edits GitHub has not confirmed yet, those fields stay as the user left them
+            FProjectItem Merged = FreshItem;
+            if (!Merged.StartDateFieldId.IsEmpty() && MutationQueue->HasUnsettled(Merged.ItemId, Merged.StartDateFieldId))
+            {
+                Merged.StartDate = Existing->StartDate;
+                Merged.StartDateTime = Existing->StartDateTime;
+            }
+            if (!Merged.EndDateFieldId.IsEmpty() && MutationQueue->HasUnsettled(Merged.ItemId, Merged.EndDateFieldId))
+            {
+                Merged.EndDate = Existing->EndDate;
+                Merged.EndDateTime = Existing->EndDateTime;
+            }
+            if (!ColumnFieldId.IsEmpty() && MutationQueue->HasUnsettled(Merged.ItemId, ColumnFieldId))
+            {
+                Merged.ColumnId = Existing->ColumnId;
+                Merged.ColumnName = Existing->ColumnName;
+            }
+
+            // Content that could not be looked up stays as it was instead of emptying the card
+            if (Merged.bContentMissing && !Existing->bContentMissing)
+            {
+                KeepContent(*Existing, Merged);
+            }
+            Merged.ContentHash = GitHubBoardDiff::HashItemContent(Merged);
+
+            const FString PreviousColumnId = Existing->ColumnId;
+            const bool bChanged = Existing->ContentHash != Merged.ContentHash;
+            if (!bChanged && PreviousColumnId == Merged.ColumnId)
+            {
+                continue;
+            }
+
+            *Existing = MoveTemp(Merged);
+
+            // An item still to be delivered reaches the listeners in this fresh state anyway
+            if (!ItemDelivery->IsPending(ProjectId, Existing->ItemId))
+            {
+                if (bChanged)
                 {
-                    startDateFieldId = FieldId;
+                    ChangedItems.Add(*Existing);
                 }
-                else if (FieldName == "EndDate")
+                if (PreviousColumnId != Existing->ColumnId)
                 {
-                    endDateFieldId = FieldId;
+                    MovedItems.Emplace(*Existing, PreviousColumnId);
                 }
             }
         }
+
+        const FProjectItem& Item = Existing ? *Existing : Items.Last();
+        if (SearchIndex)
+        {
+            (*SearchIndex)->UpdateItem(Item);
+        }
+        if (TimelineIndex)
+        {
+            (*TimelineIndex)->UpdateItem(Item);
+        }
+        if (Analytics)
+        {
+            (*Analytics)->UpdateItem(Item, Now);
+        }
+        EventLog->UpdateItem(ProjectId, Item, Now);
     }
 
-    TSharedPtr<FJsonObject> ItemsObject = NodeObject->GetObjectField("items");
-    if (!ItemsObject.IsValid())
+    UpdateDashboardFromBoard(**Board);
+    ScheduleEventLogFlush();
+    if (RemovedItemIds.Num() > 0)
     {
-        UE_LOG(LogTemp, Error, TEXT("Items object is invalid."));
-        AsyncTask(ENamedThreads::GameThread, [this, ProjectInfo]()
-            {
-                OnProjectDetailsLoaded.Broadcast(ProjectInfo);
-            });
-        return;
+        PruneEntityCache();
     }
 
-    const TArray<TSharedPtr<FJsonValue>>* ItemsArray;
-    if (!ItemsObject->TryGetArrayField("nodes", ItemsArray))
+    // Same events and order as an incremental board refresh
+    if (RemovedItemIds.Num() > 0)
+    {
+        OnItemsRemoved.Broadcast(ProjectId, RemovedItemIds);
+    }
+
+    if (AddedItems.Num() > 0)
+    {
+        OnItemsAdded.Broadcast(ProjectId, AddedItems);
+    }
+
+    if (ChangedItems.Num() > 0)
+    {
+        OnItemsChanged.Broadcast(ProjectId, ChangedItems);
+    }
+
+    for (const TPair<FProjectItem, FString>& Move : MovedItems)
+    {
+        OnItemMoved.Broadcast(ProjectId, Move.Key, Move.Value, Move.Key.ColumnId);
+    }
+
+    // A board still being handed out in chunks is completed by its delivery
+    if (ItemDelivery->IsActive(ProjectId) || (RemovedItemIds.Num() == 0 && AddedItems.Num() == 0 && ChangedItems.Num() == 0 && MovedItems.Num() == 0))
     {
-        UE_LOG(LogTemp, Error, TEXT("Error retrieving items array."));
-        AsyncTask(ENamedThreads::GameThread, [this, ProjectInfo]()
-            {
-                OnProjectDetailsLoaded.Broadcast(ProjectInfo);
-            });
         return;
     }
 
-    for (const TSharedPtr<FJsonValue>& ItemValue : *ItemsArray)
+    FGitHubBoardHandle Handle;
+    Handle.Snapshot = *Board;
+    OnProjectBoardPublished.Broadcast(Handle);
+    if (OnProjectDetailsLoaded.IsBound())
     {
-        TSharedPtr<FJsonObject> ItemObject = ItemValue->AsObject();
-        if (!ItemObject.IsValid())
-        {
-            continue;
-        }
+        OnProjectDetailsLoaded.Broadcast(**Board);
+    }
+}
 
-        FProjectItem ProjectItem;
-        ProjectItem.ItemId = GetStringFieldSafe(ItemObject, "id");
-        // Set field IDs regardless of whether dates exist
-        ProjectItem.StartDateFieldId = startDateFieldId;
-        ProjectItem.EndDateFieldId = endDateFieldId;
+TArray<FString> UGitHubAPIManager::SearchProjectItems(const FString& ProjectId, const FString& Query, int32 MaxResults)
+{
+    GITHUB_TRACE_SCOPE(GitHub_SearchProjectItems);
 
-        if (ItemObject->HasTypedField<EJson::Object>("fieldValues"))
-        {
-            TSharedPtr<FJsonObject> FieldValuesObject = ItemObject->GetObjectField("fieldValues");
-            const TArray<TSharedPtr<FJsonValue>>* FieldValuesNodes;
-            if (FieldValuesObject->TryGetArrayField("nodes", FieldValuesNodes))
-            {
-                for (const TSharedPtr<FJsonValue>& FieldValue : *FieldValuesNodes)
-                {
-                    TSharedPtr<FJsonObject> FieldValueObject = FieldValue->AsObject();
-                    if (!FieldValueObject.IsValid())
-                    {
-                        continue;
-                    }
+    // Only counts as a use of the board, an evicted one has to be opened again to be searched
+    FindLoadedBoard(ProjectId);
+    const TSharedPtr<FGitHubSearchIndex>* SearchIndex = SearchIndices.Find(ProjectId);
+    if (!SearchIndex)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Project '%s' has not been loaded, nothing to search."), *ProjectId);
+        return TArray<FString>();
+    }
 
-                    if (FieldValueObject->HasField("name") && FieldValueObject->HasField("field"))
-                    {
-                        FString Name = GetStringFieldSafe(FieldValueObject, "name");
-                        TSharedPtr<FJsonObject> FieldObject = FieldValueObject->GetObjectField("field");
-                        if (FieldObject.IsValid())
-                        {
-                            FString FieldName = GetStringFieldSafe(FieldObject, "name");
-                            FString FieldId = GetStringFieldSafe(FieldObject, "id");
+    return (*SearchIndex)->Search(Query, MaxResults);
+}
 
-                            if (FieldName == "Status")
-                            {
-                                ProjectItem.ColumnName = Name;
-                                FString OptionId = GetStringFieldSafe(FieldValueObject, "optionId");
-                                ProjectItem.ColumnId = OptionId;
-                            }
-                        }
-                    }
+TArray<FString> UGitHubAPIManager::QueryTimelineOverlap(const FString& ProjectId, const FDateTime& From, const FDateTime& To)
+{
+    GITHUB_TRACE_SCOPE(GitHub_QueryTimeline);
 
-                    if (FieldValueObject->HasField("date") && FieldValueObject->HasField("field"))
-                    {
-                        FString DateValue = GetStringFieldSafe(FieldValueObject, "date");
-                        TSharedPtr<FJsonObject> FieldObject = FieldValueObject->GetObjectField("field");
-                        if (FieldObject.IsValid())
-                        {
-                            FString FieldName = GetStringFieldSafe(FieldObject, "name");
+    FindLoadedBoard(ProjectId);
+    const TSharedPtr<FGitHubTimelineIndex>* TimelineIndex = TimelineIndices.Find(ProjectId);
+    if (!TimelineIndex)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Project '%s' has not been loaded, no timeline available."), *ProjectId);
+        return TArray<FString>();
+    }
 
-                            if (FieldName == "StartDate")
-                            {
-                                ProjectItem.StartDate = DateValue;
-                            }
-                            else if (FieldName == "EndDate")
-                            {
-                                ProjectItem.EndDate = DateValue;
-                            }
-                        }
-                    }
-                }
-            }
-        }
+    return (*TimelineIndex)->QueryOverlapping(From, To);
+}
 
-        if (ItemObject->HasTypedField<EJson::Object>("content"))
-        {
-            TSharedPtr<FJsonObject> ContentObject = ItemObject->GetObjectField("content");
-            if (ContentObject.IsValid())
-            {
-                FString TypeName = GetStringFieldSafe(ContentObject, "__typename");
-                ProjectItem.Type = TypeName;
+TArray<FString> UGitHubAPIManager::QueryTimelineRange(const FString& ProjectId, const FDateTime& From, const FDateTime& To)
+{
+    GITHUB_TRACE_SCOPE(GitHub_QueryTimeline);
 
-                if (TypeName == "Issue")
-                {
-                    ProjectItem.Title = GetStringFieldSafe(ContentObject, "title");
-                    ProjectItem.Url = GetStringFieldSafe(ContentObject, "url");
-                    ProjectItem.CreatedAt = GetStringFieldSafe(ContentObject, "createdAt");
-                    ProjectItem.State = GetStringFieldSafe(ContentObject, "issueState");
-                    ProjectItem.Body = GetStringFieldSafe(ContentObject, "body");
-                }
-                else if (TypeName == "PullRequest")
-                {
-                    ProjectItem.Title = GetStringFieldSafe(ContentObject, "title");
-                    ProjectItem.Url = GetStringFieldSafe(ContentObject, "url");
-                    ProjectItem.CreatedAt = GetStringFieldSafe(ContentObject, "createdAt");
-                    ProjectItem.State = GetStringFieldSafe(ContentObject, "pullRequestState");
-                    ProjectItem.Body = GetStringFieldSafe(ContentObject, "body");
-                }
-                else if (TypeName == "DraftIssue")
-                {
-                    ProjectItem.Title = GetStringFieldSafe(ContentObject, "title");
-                    ProjectItem.CreatedAt = GetStringFieldSafe(ContentObject, "createdAt");
-                    ProjectItem.Body = GetStringFieldSafe(ContentObject, "body");
-                    ProjectItem.State = "DRAFT";
-                    ProjectItem.Url = "";
-                }
-            }
-        }
+    FindLoadedBoard(ProjectId);
+    const TSharedPtr<FGitHubTimelineIndex>* TimelineIndex = TimelineIndices.Find(ProjectId);
+    if (!TimelineIndex)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Project '%s' has not been loaded, no timeline available."), *ProjectId);
+        return TArray<FString>();
+    }
+
+    return (*TimelineIndex)->QueryContained(From, To);
+}
 
-        ProjectInfo.Items.Add(ProjectItem);
+TArray<FString> UGitHubAPIManager::GetNextDueItems(const FString& ProjectId, const FDateTime& After, int32 MaxResults)
+{
+    GITHUB_TRACE_SCOPE(GitHub_QueryTimeline);
+
+    FindLoadedBoard(ProjectId);
+    const TSharedPtr<FGitHubTimelineIndex>* TimelineIndex = TimelineIndices.Find(ProjectId);
+    if (!TimelineIndex)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Project '%s' has not been loaded, no timeline available."), *ProjectId);
+        return TArray<FString>();
     }
 
-    AsyncTask(ENamedThreads::GameThread, [this, ProjectInfo]()
+    return (*TimelineIndex)->QueryNextDue(After, MaxResults);
+}
+
+void UGitHubAPIManager::CreateProjectItem(const FString& ProjectId, const FString& Title, const FString& FieldId, const FString& ColumnId)
+{
+    CreateProjectItemAsync(ProjectId, Title, FieldId, ColumnId).Next([this](TGitHubResult<FString> Result)
         {
-            OnProjectDetailsLoaded.Broadcast(ProjectInfo);
+            const bool bCreated = Result.HasValue();
+            RunOnGameThread([this, bCreated]()
+                {
+                    if (bCreated)
+                    {
+                        OnItemCreated.Broadcast();
+                    }
+                    else
+                    {
+                        OnMutationCompleted.Broadcast(false);
+                    }
+                });
         });
 }
 
-void UGitHubAPIManager::CreateProjectItem(const FString& ProjectId, const FString& Title, const FString& FieldId, const FString& ColumnId)
+TGitHubFuture<FString> UGitHubAPIManager::CreateProjectItemAsync(const FString& ProjectId, const FString& Title, const FString& FieldId, const FString& ColumnId, const FGitHubCancellationTokenPtr& Token)
 {
     FString Mutation = FString::Printf(TEXT(
         "mutation {"
@@ -835,18 +3244,11 @@ void UGitHubAPIManager::CreateProjectItem(const FString& ProjectId, const FStrin
         "  }"
         "}"), *ProjectId, *Title);
 
-    SendGraphQLMutation(Mutation, [this, ProjectId, FieldId, ColumnId](TSharedPtr<FJsonObject> ResponseObject)
-        {
-            if (!ResponseObject.IsValid() || !ResponseObject->HasField("data"))
-            {
-                AsyncTask(ENamedThreads::GameThread, [this]() { OnMutationCompleted.Broadcast(false); });
-                return;
-            }
+    TGitHubFuture<FString> Created = QueryStringFieldAsync(Mutation, { TEXT("data"), TEXT("addProjectV2DraftIssue"), TEXT("projectItem") }, TEXT("id"), TEXT("CreateProjectItem"), Token);
 
-            TSharedPtr<FJsonObject> CreateObject = ResponseObject->GetObjectField("data")->GetObjectField("addProjectV2DraftIssue");
-            FString ItemId = CreateObject->GetObjectField("projectItem")->GetStringField("id");
-
-            if (!FieldId.IsEmpty() && !ColumnId.IsEmpty())
+    if (!FieldId.IsEmpty() && !ColumnId.IsEmpty())
+    {
+        Created = GitHubAsync::Then<FString>(MoveTemp(Created), [this, ProjectId, FieldId, ColumnId, Token](const FString& ItemId)
             {
                 FString UpdateMutation = FString::Printf(TEXT(
                     "mutation {"
@@ -864,37 +3266,27 @@ void UGitHubAPIManager::CreateProjectItem(const FString& ProjectId, const FStrin
                     "  }"
                     "}"), *ProjectId, *ItemId, *FieldId, *ColumnId);
 
-                SendGraphQLMutation(UpdateMutation, [this, ProjectId](TSharedPtr<FJsonObject> UpdateResponse)
-                    {
-                        AsyncTask(ENamedThreads::GameThread, [this, ProjectId]()
-                            {
-                                OnItemCreated.Broadcast();
-                                for (const TPair<FString, FProjectInfo>& Pair : UserProjects)
-                                {
-                                    if (Pair.Value.ProjectId == ProjectId)
-                                    {
-                                        FetchProjectDetails(Pair.Value.ProjectTitle);
-                                        break;
-                                    }
-                                }
-                            });
-                    });
-            }
-            else
-            {
-                AsyncTask(ENamedThreads::GameThread, [this, ProjectId]()
-                    {
-                        OnItemCreated.Broadcast();
-                        for (const TPair<FString, FProjectInfo>& Pair : UserProjects)
+                // The draft exists on GitHub either way, a column that could not be set is reported on its own
+                return QueryStringFieldAsync(UpdateMutation, { TEXT("data"), TEXT("updateProjectV2ItemFieldValue"), TEXT("projectV2Item") }, TEXT("id"), TEXT("SetItemColumn"), Token)
+                    .Next([this, ItemId, Token](TGitHubResult<FString> Result) -> TGitHubResult<FString>
                         {
-                            if (Pair.Value.ProjectId == ProjectId)
+                            if (Result.HasError() && !(Token.IsValid() && Token->IsCancelled()))
                             {
-                                FetchProjectDetails(Pair.Value.ProjectTitle);
-                                break;
+                                UE_LOG(LogTemp, Warning, TEXT("Item %s was created, but its column could not be set: %s"), *ItemId, *Result.GetError());
+                                RunOnGameThread([this]() { OnMutationCompleted.Broadcast(false); });
                             }
-                        }
-                    });
+                            return MakeValue(ItemId);
+                        });
+            });
+    }
+
+    return Created.Next([this, ProjectId](TGitHubResult<FString> Result)
+        {
+            if (Result.HasValue())
+            {
+                RunOnGameThread([this, ProjectId, ItemId = Result.GetValue()]() { RevalidateItems(ProjectId, { ItemId }); });
             }
+            return Result;
         });
 }
 
@@ -906,106 +3298,318 @@ void UGitHubAPIManager::UpdateProjectItemDateValue(const FString& ProjectId, con
         FormattedDate = FString::Printf(TEXT("%sT00:00:00.000Z"), *NewDateValue);
     }
 
-    FString Mutation = FString::Printf(
-        TEXT("mutation { "
-            "updateProjectV2ItemFieldValue( "
-            "input: { "
-            "projectId: \"%s\" "
-            "itemId: \"%s\" "
-            "fieldId: \"%s\" "
-            "value: { "
-            "date: \"%s\" "
-            "} "
-            "} "
-            ") { "
-            "projectV2Item { "
-            "id "
-            "fieldValues(first: 8) { "
-            "nodes { "
-            "... on ProjectV2ItemFieldDateValue { "
-            "date "
-            "field { "
-            "... on ProjectV2Field { "
-            "name "
-            "} "
-            "} "
-            "} "
-            "} "
-            "} "
-            "} "
-            "} "
-            "}"),
-        *ProjectId, *ItemId, *FieldId, *FormattedDate);
-
-    //UE_LOG(LogTemp, Log, TEXT("Sending mutation: %s"), *Mutation);
-
-    SendGraphQLMutation(Mutation, [this](TSharedPtr<FJsonObject> ResponseObject)
-        {
-            if (!ResponseObject.IsValid())
-            {
-                UE_LOG(LogTemp, Error, TEXT("Ungltige Antwort vom Server."));
-                return;
+    // Shown right away, the journaled edit catches up with GitHub whenever it can be delivered
+    UpdateLoadedItem(ProjectId, ItemId, [&FieldId, &NewDateValue](FProjectItem& Item)
+        {
+            if (FieldId == Item.StartDateFieldId)
+            {
+                Item.StartDate = NewDateValue;
+                Item.StartDateTime = ParseProjectDate(NewDateValue);
             }
-
-            TSharedPtr<FJsonObject> DataObject = ResponseObject->GetObjectField("data");
-            if (!DataObject.IsValid())
+            else if (FieldId == Item.EndDateFieldId)
             {
-                UE_LOG(LogTemp, Error, TEXT("Fehler beim Parsen des Datenobjekts."));
-                return;
+                Item.EndDate = NewDateValue;
+                Item.EndDateTime = ParseProjectDate(NewDateValue);
             }
+        });
+
+    FGitHubQueuedMutation Mutation;
+    Mutation.ProjectId = ProjectId;
+    Mutation.ItemId = ItemId;
+    Mutation.FieldId = FieldId;
+    Mutation.Kind = EGitHubFieldValueKind::Date;
+    Mutation.Value = FormattedDate;
+
+    if (DateEditDebounceSeconds <= 0.0f)
+    {
+        QueueFieldValueUpdate(Mutation);
+        return;
+    }
+
+    // Dragging produces a stream of edits, only the value the field settles on is sent
+    MutationQueue->Stage(Mutation, FPlatformTime::Seconds() + DateEditDebounceSeconds);
+    OnPendingMutationsChanged.Broadcast(MutationQueue->Num());
+
+    if (!StagedMutationHandle.IsValid())
+    {
+        StagedMutationHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+            {
+                FlushStagedMutations();
+                return false;
+            }), DateEditDebounceSeconds);
+    }
+}
+
+void UGitHubAPIManager::MoveProjectItem(const FString& ProjectId, const FString& ItemId, const FString& NewColumnId, const FString& StatusFieldId)
+{
+    // Keep the cached board and its index current until the refresh after delivery lands
+    const TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>* Board = FindOrRestoreBoard(ProjectId);
+    const FColumnInfo* Column = Board ? (*Board)->Columns.FindByPredicate([&NewColumnId](const FColumnInfo& Candidate) { return Candidate.ColumnId == NewColumnId; }) : nullptr;
+    const FString ColumnName = Column ? Column->ColumnName : FString();
+    UpdateLoadedItem(ProjectId, ItemId, [&NewColumnId, &ColumnName](FProjectItem& Item)
+        {
+            Item.ColumnId = NewColumnId;
+            Item.ColumnName = ColumnName;
+        });
+
+    FGitHubQueuedMutation Mutation;
+    Mutation.ProjectId = ProjectId;
+    Mutation.ItemId = ItemId;
+    Mutation.FieldId = StatusFieldId;
+    Mutation.Kind = EGitHubFieldValueKind::SingleSelectOption;
+    Mutation.Value = NewColumnId;
+    QueueFieldValueUpdate(Mutation);
+}
+
+TGitHubFuture<FString> UGitHubAPIManager::UpdateProjectItemDateValueAsync(const FString& ProjectId, const FString& ItemId, const FString& FieldId, const FString& NewDateValue, const FGitHubCancellationTokenPtr& Token)
+{
+    TGitHubFuture<FString> Future = TrackQueuedMutation(ProjectId, ItemId, FieldId, Token);
+    UpdateProjectItemDateValue(ProjectId, ItemId, FieldId, NewDateValue);
+    return Future;
+}
+
+TGitHubFuture<FString> UGitHubAPIManager::MoveProjectItemAsync(const FString& ProjectId, const FString& ItemId, const FString& NewColumnId, const FString& StatusFieldId, const FGitHubCancellationTokenPtr& Token)
+{
+    TGitHubFuture<FString> Future = TrackQueuedMutation(ProjectId, ItemId, StatusFieldId, Token);
+    MoveProjectItem(ProjectId, ItemId, NewColumnId, StatusFieldId);
+    return Future;
+}
 
-            FString ResponseString;
-            TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResponseString);
-            FJsonSerializer::Serialize(ResponseObject.ToSharedRef(), Writer);
-            //UE_LOG(LogTemp, Log, TEXT("Response received: %s"), *ResponseString);
+TGitHubFuture<FString> UGitHubAPIManager::TrackQueuedMutation(const FString& ProjectId, const FString& ItemId, const FString& FieldId, const FGitHubCancellationTokenPtr& Token)
+{
+    TSharedRef<TGitHubPromise<FString>, ESPMode::ThreadSafe> Promise = MakeShared<TGitHubPromise<FString>, ESPMode::ThreadSafe>();
+    MutationPromises.FindOrAdd(ItemId / FieldId).Add(Promise);
+
+    if (!Token.IsValid())
+    {
+        return Promise->GetFuture();
+    }
 
-            AsyncTask(ENamedThreads::GameThread, [this]()
+    // Cancel may come from any thread, the queue is only touched on the game thread
+    const FDelegateHandle CancelHandle = Token->AddCancelHandler([this, ProjectId, ItemId, FieldId]()
+        {
+            RunOnGameThread([this, ProjectId, ItemId, FieldId]()
                 {
-                    OnMutationCompleted.Broadcast(true);
+                    WithdrawQueuedMutation(ProjectId, ItemId, FieldId);
                 });
         });
+
+    // A settled edit has nothing left to withdraw, the token may still serve other requests
+    TWeakPtr<FGitHubCancellationToken, ESPMode::ThreadSafe> WeakToken = Token;
+    return Promise->GetFuture().Next([WeakToken, CancelHandle](TGitHubResult<FString> Result)
+        {
+            if (FGitHubCancellationTokenPtr PinnedToken = WeakToken.Pin())
+            {
+                PinnedToken->RemoveCancelHandler(CancelHandle);
+            }
+            return Result;
+        });
 }
 
-void UGitHubAPIManager::MoveProjectItem(const FString& ProjectId, const FString& ItemId, const FString& NewColumnId, const FString& StatusFieldId)
+void UGitHubAPIManager::WithdrawQueuedMutation(const FString& ProjectId, const FString& ItemId, const FString& FieldId)
 {
-    FString Mutation = FString::Printf(TEXT(
-        "mutation {"
-        "  updateProjectV2ItemFieldValue("
-        "    input: {"
-        "      projectId: \"%s\""
-        "      itemId: \"%s\""
-        "      fieldId: \"%s\""
-        "      value: { singleSelectOptionId: \"%s\" }"
-        "    }"
-        "  ) {"
-        "    projectV2Item {"
-        "      id"
-        "    }"
-        "  }"
-        "}"), *ProjectId, *ItemId, *StatusFieldId, *NewColumnId);
+    // An edit already on its way completes with GitHub's answer
+    if (!MutationQueue->Withdraw(ItemId, FieldId))
+    {
+        return;
+    }
+
+    CompleteQueuedMutation(ItemId, FieldId, TEXT("Cancelled"));
+    OnPendingMutationsChanged.Broadcast(MutationQueue->Num());
+
+    // Undo the optimistic edit
+    RevalidateItems(ProjectId, { ItemId });
+}
+
+void UGitHubAPIManager::CompleteQueuedMutation(const FString& ItemId, const FString& FieldId, const FString& Error)
+{
+    TArray<TSharedRef<TGitHubPromise<FString>, ESPMode::ThreadSafe>> Promises;
+    if (!MutationPromises.RemoveAndCopyValue(ItemId / FieldId, Promises))
+    {
+        return;
+    }
+
+    for (const TSharedRef<TGitHubPromise<FString>, ESPMode::ThreadSafe>& Promise : Promises)
+    {
+        if (Error.IsEmpty())
+        {
+            Promise->Complete(MakeValue(ItemId));
+        }
+        else
+        {
+            Promise->Complete(MakeError(Error));
+        }
+    }
+}
+
+int32 UGitHubAPIManager::GetPendingMutationCount() const
+{
+    return MutationQueue->Num();
+}
+
+void UGitHubAPIManager::QueueFieldValueUpdate(const FGitHubQueuedMutation& Mutation)
+{
+    if (MutationQueue->Enqueue(Mutation))
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("Pending edit of field %s on item %s replaced by a newer value."), *Mutation.FieldId, *Mutation.ItemId);
+    }
+
+    OnPendingMutationsChanged.Broadcast(MutationQueue->Num());
+    PumpMutationQueue();
+}
+
+void UGitHubAPIManager::PumpMutationQueue()
+{
+    // While a retry is scheduled, new edits only coalesce into the journal
+    if (AccessToken.IsEmpty() || MutationRetryHandle.IsValid())
+    {
+        return;
+    }
+
+    TArray<FGitHubQueuedMutation> Batch;
+    if (!MutationQueue->BeginNext(Batch, MaxMutationBatchSize))
+    {
+        return;
+    }
+
+    // Aliased fields let all pending edits of one item, like its start and end date, go out as one request
+    bool bColumnChange = false;
+    FString Document = TEXT("mutation {");
+    for (int32 Index = 0; Index < Batch.Num(); ++Index)
+    {
+        const FGitHubQueuedMutation& Mutation = Batch[Index];
+        bColumnChange |= Mutation.Kind == EGitHubFieldValueKind::SingleSelectOption;
+
+        const FString Value = Mutation.Kind == EGitHubFieldValueKind::SingleSelectOption
+            ? FString::Printf(TEXT("singleSelectOptionId: \"%s\""), *Mutation.Value)
+            : FString::Printf(TEXT("date: \"%s\""), *Mutation.Value);
+
+        Document += FString::Printf(TEXT(
+            "  edit%d: updateProjectV2ItemFieldValue("
+            "    input: {"
+            "      projectId: \"%s\""
+            "      itemId: \"%s\""
+            "      fieldId: \"%s\""
+            "      value: { %s }"
+            "    }"
+            "  ) {"
+            "    projectV2Item {"
+            "      id"
+            "    }"
+            "  }"), Index, *Mutation.ProjectId, *Mutation.ItemId, *Mutation.FieldId, *Value);
+    }
+    Document += TEXT("}");
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateGraphQLRequest(Document);
 
-    SendGraphQLMutation(Mutation, [this, ProjectId](TSharedPtr<FJsonObject> ResponseObject)
+    FGitHubTraceFlowPtr Flow = GitHubTrace::BeginFlow(bColumnChange ? TEXT("MoveProjectItem") : TEXT("UpdateItemDate"));
+    Request->OnProcessRequestComplete().BindLambda([this, Flow, Batch](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bWasSuccessful)
         {
-            if (!ResponseObject.IsValid())
+            Flow->MarkStage(TEXT("Completed"));
+
+            const int32 ResponseCode = bWasSuccessful && ResponsePtr.IsValid() ? ResponsePtr->GetResponseCode() : 0;
+            if (ResponseCode != 200)
             {
-                UE_LOG(LogTemp, Error, TEXT("Ungltige Antwort vom Server."));
-                AsyncTask(ENamedThreads::GameThread, [this]() { OnMutationCompleted.Broadcast(false); });
+                LogHttpError(ResponsePtr);
+
+                // No answer, server trouble and rate limits are worth another attempt, anything else would fail again
+                const bool bRetry = ResponseCode == 0 || ResponseCode == 429 || ResponseCode >= 500
+                    || (ResponseCode == 403 && ResponsePtr->GetHeader(TEXT("x-ratelimit-remaining")) == TEXT("0"));
+
+                GitHubTrace::FFlowScope FlowScope(Flow);
+                RunOnGameThread([this, Batch, bRetry]()
+                    {
+                        HandleQueuedMutationResult(Batch, bRetry ? EGitHubMutationResult::Retry : EGitHubMutationResult::Rejected);
+                    });
                 return;
             }
 
-            AsyncTask(ENamedThreads::GameThread, [this, ProjectId]()
+            RunOnWorkerThread(Flow, [this, Batch, ResponsePtr]()
                 {
-                    OnMutationCompleted.Broadcast(true);
-                    for (const TPair<FString, FProjectInfo>& Pair : UserProjects)
-                    {
-                        if (Pair.Value.ProjectId == ProjectId)
+                    // GraphQL errors mean GitHub refused the edit, sending it again would not change that
+                    const bool bApplied = DeserializeGraphQLResponse(ResponsePtr).IsValid();
+                    RunOnGameThread([this, Batch, bApplied]()
                         {
-                            FetchProjectDetails(Pair.Value.ProjectTitle);
-                            break;
-                        }
-                    }
+                            HandleQueuedMutationResult(Batch, bApplied ? EGitHubMutationResult::Applied : EGitHubMutationResult::Rejected);
+                        });
                 });
         });
+
+    DispatchRequest(Request);
+}
+
+void UGitHubAPIManager::FlushStagedMutations()
+{
+    StagedMutationHandle.Reset();
+
+    const double Now = FPlatformTime::Seconds();
+    const double NextReadyTime = MutationQueue->EnqueueStaged(Now);
+
+    // Values still being dragged are journaled at most once per run of this ticker
+    MutationQueue->SaveStaged();
+    if (NextReadyTime > 0.0)
+    {
+        StagedMutationHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+            {
+                FlushStagedMutations();
+                return false;
+            }), float(NextReadyTime - Now));
+    }
+
+    PumpMutationQueue();
+}
+
+void UGitHubAPIManager::HandleQueuedMutationResult(const TArray<FGitHubQueuedMutation>& Batch, EGitHubMutationResult Result)
+{
+    if (Result == EGitHubMutationResult::Retry)
+    {
+        MutationQueue->AbortInFlight();
+        MutationRetryDelay = FMath::Clamp(MutationRetryDelay * 2.0f, MinMutationRetryDelay, MaxMutationRetryDelay);
+        UE_LOG(LogTemp, Warning, TEXT("GitHub not reachable, %d pending edits are retried in %.0f s."), MutationQueue->Num(), MutationRetryDelay);
+
+        MutationRetryHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+            {
+                MutationRetryHandle.Reset();
+                PumpMutationQueue();
+                return false;
+            }), MutationRetryDelay);
+        return;
+    }
+
+    MutationQueue->CompleteInFlight();
+    OnPendingMutationsChanged.Broadcast(MutationQueue->Num());
+
+    // A newer value for the same field settles its futures once it has been sent itself
+    for (const FGitHubQueuedMutation& Sent : Batch)
+    {
+        if (!MutationQueue->HasPending(Sent.ItemId, Sent.FieldId))
+        {
+            CompleteQueuedMutation(Sent.ItemId, Sent.FieldId, Result == EGitHubMutationResult::Applied ? FString() : FString(TEXT("Rejected by GitHub.")));
+        }
+    }
+
+    // A batch only ever holds edits of one item
+    const FGitHubQueuedMutation& Mutation = Batch[0];
+    if (Result == EGitHubMutationResult::Applied)
+    {
+        MutationRetryDelay = 0.0f;
+        OnMutationCompleted.Broadcast(true);
+
+        if (Batch.ContainsByPredicate([](const FGitHubQueuedMutation& Candidate) { return Candidate.Kind == EGitHubFieldValueKind::SingleSelectOption; }))
+        {
+            RevalidateItems(Mutation.ProjectId, { Mutation.ItemId });
+        }
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("GitHub rejected %d edit(s) of item %s."), Batch.Num(), *Mutation.ItemId);
+        OnMutationCompleted.Broadcast(false);
+
+        // Roll the optimistic edit back to what GitHub has
+        RevalidateItems(Mutation.ProjectId, { Mutation.ItemId });
+    }
+
+    PumpMutationQueue();
 }
 
 
@@ -0,0 +1,154 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Delegates/IDelegateInstance.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/ValueOrError.h"
+#include <atomic>
+
+// Outcome of an async GitHub operation: the value, or a readable error ("Cancelled" after Cancel)
+template <typename ValueType>
+using TGitHubResult = TValueOrError<ValueType, FString>;
+
+template <typename ValueType>
+using TGitHubFuture = TFuture<TGitHubResult<ValueType>>;
+
+/**
+ * Cancels one async operation, including every request of a multi-step chain that is still to come.
+ * Cancel completes the operation's future right away with an error, the request in flight is dropped from the pool.
+ * Thread-safe.
+ */
+class UEGITHUBMANAGER_API FGitHubCancellationToken
+{
+public:
+	static TSharedRef<FGitHubCancellationToken, ESPMode::ThreadSafe> Create();
+
+	void Cancel();
+	bool IsCancelled() const;
+
+	// Runs Handler on Cancel, or right away if already cancelled. Requests running side by side each add their own
+	// handler and remove it once they completed, the returned handle is unset when Handler already ran.
+	FDelegateHandle AddCancelHandler(TFunction<void()> Handler);
+	void RemoveCancelHandler(FDelegateHandle Handle);
+
+private:
+	mutable FCriticalSection Lock;
+	bool bCancelled = false;
+	TArray<TPair<FDelegateHandle, TFunction<void()>>> CancelHandlers;
+};
+
+using FGitHubCancellationTokenPtr = TSharedPtr<FGitHubCancellationToken, ESPMode::ThreadSafe>;
+
+/** Promise that a response and a Cancel race for, the first Complete wins and later ones are ignored. */
+template <typename ValueType>
+class TGitHubPromise
+{
+public:
+	TGitHubFuture<ValueType> GetFuture()
+	{
+		return Promise.GetFuture();
+	}
+
+	bool Complete(TGitHubResult<ValueType> &&Result)
+	{
+		if (bCompleted.exchange(true))
+		{
+			return false;
+		}
+
+		Promise.SetValue(MoveTemp(Result));
+		return true;
+	}
+
+private:
+	TPromise<TGitHubResult<ValueType>> Promise;
+	std::atomic<bool> bCompleted = false;
+};
+
+namespace GitHubAsync
+{
+	template <typename ValueType>
+	TGitHubFuture<ValueType> MakeReady(TGitHubResult<ValueType> &&Result)
+	{
+		return MakeFulfilledPromise<TGitHubResult<ValueType>>(MoveTemp(Result)).GetFuture();
+	}
+
+	// Runs Step with the value of Future once it is ready and forwards the future Step returns.
+	// An error skips Step. Step runs on whichever thread completed Future, usually a worker.
+	template <typename NextValueType, typename ValueType, typename StepType>
+	TGitHubFuture<NextValueType> Then(TGitHubFuture<ValueType> &&Future, StepType Step)
+	{
+		TSharedRef<TGitHubPromise<NextValueType>, ESPMode::ThreadSafe> Promise = MakeShared<TGitHubPromise<NextValueType>, ESPMode::ThreadSafe>();
+		TGitHubFuture<NextValueType> Result = Promise->GetFuture();
+
+		Future.Next([Promise, Step = MoveTemp(Step)](TGitHubResult<ValueType> Previous) mutable
+			{
+				if (Previous.HasError())
+				{
+					Promise->Complete(MakeError(Previous.StealError()));
+					return;
+				}
+
+				Step(Previous.StealValue()).Next([Promise](TGitHubResult<NextValueType> Next)
+					{
+						Promise->Complete(MoveTemp(Next));
+					});
+			});
+
+		return Result;
+	}
+
+	// Completes with all values in the order of Futures once every one has arrived, or with the first error
+	template <typename ValueType>
+	TGitHubFuture<TArray<ValueType>> WhenAll(TArray<TGitHubFuture<ValueType>> &&Futures)
+	{
+		struct FJoin
+		{
+			TGitHubPromise<TArray<ValueType>> Promise;
+			FCriticalSection Lock;
+			TArray<ValueType> Values;
+			int32 Remaining = 0;
+		};
+
+		TSharedRef<FJoin, ESPMode::ThreadSafe> Join = MakeShared<FJoin, ESPMode::ThreadSafe>();
+		TGitHubFuture<TArray<ValueType>> Result = Join->Promise.GetFuture();
+
+		Join->Values.SetNum(Futures.Num());
+		Join->Remaining = Futures.Num();
+		if (Futures.Num() == 0)
+		{
+			Join->Promise.Complete(MakeValue(TArray<ValueType>()));
+			return Result;
+		}
+
+		for (int32 Index = 0; Index < Futures.Num(); ++Index)
+		{
+			Futures[Index].Next([Join, Index](TGitHubResult<ValueType> Value)
+				{
+					if (Value.HasError())
+					{
+						Join->Promise.Complete(MakeError(Value.StealError()));
+						return;
+					}
+
+					bool bLast = false;
+					{
+						FScopeLock ScopeLock(&Join->Lock);
+						Join->Values[Index] = Value.StealValue();
+						bLast = --Join->Remaining == 0;
+					}
+
+					if (bLast)
+					{
+						Join->Promise.Complete(MakeValue(MoveTemp(Join->Values)));
+					}
+				});
+		}
+
+		return Result;
+	}
+}
@@ -0,0 +1,158 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/CancellableAsyncAction.h"
+#include "UGitHubAPIManager.h"
+#include "GitHubAsyncActions.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FGitHubAsyncTextResult, const FString &, Value, const FString &, Error);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FGitHubAsyncBoardResult, const FGitHubBoardHandle &, Board, const FString &, Error);
+
+/**
+ * Latent Blueprint nodes over the future based calls of UGitHubAPIManager.
+ * Several nodes can run side by side, each one is cancelled on its own and only fires its own pins.
+ */
+UCLASS(Abstract)
+class UEGITHUBMANAGER_API UGitHubAsyncAction : public UCancellableAsyncAction
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Cancel() override;
+	virtual void SetReadyToDestroy() override;
+
+protected:
+	// Keeps the node alive until it finished, through the game instance or, in editor utilities without one, the root set
+	void RegisterWithContext(const UObject *WorldContextObject);
+
+	FGitHubCancellationTokenPtr Token = FGitHubCancellationToken::Create();
+};
+
+/** Nodes resolving to a single id or name. */
+UCLASS(Abstract)
+class UEGITHUBMANAGER_API UGitHubAsyncTextAction : public UGitHubAsyncAction
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(BlueprintAssignable)
+	FGitHubAsyncTextResult OnSuccess;
+
+	UPROPERTY(BlueprintAssignable)
+	FGitHubAsyncTextResult OnFailure;
+
+protected:
+	// Fires OnSuccess or OnFailure on the game thread once Future is ready
+	void Complete(TGitHubFuture<FString> &&Future);
+};
+
+UCLASS()
+class UEGITHUBMANAGER_API UGitHubFetchCurrentUserAction : public UGitHubAsyncTextAction
+{
+	GENERATED_BODY()
+
+public:
+	// Value is the login of the authenticated user
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UGitHubFetchCurrentUserAction *FetchCurrentUserAsync(UObject *WorldContextObject);
+
+	virtual void Activate() override;
+};
+
+UCLASS()
+class UEGITHUBMANAGER_API UGitHubCreateProjectAction : public UGitHubAsyncTextAction
+{
+	GENERATED_BODY()
+
+public:
+	// Value is the ProjectId once the project exists, date fields that could not be added fire OnMutationCompleted(false)
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UGitHubCreateProjectAction *CreateNewProjectAsync(UObject *WorldContextObject, const FString &Owner, const FString &ProjectName);
+
+	virtual void Activate() override;
+
+private:
+	FString Owner;
+	FString ProjectName;
+};
+
+UCLASS()
+class UEGITHUBMANAGER_API UGitHubCreateProjectItemAction : public UGitHubAsyncTextAction
+{
+	GENERATED_BODY()
+
+public:
+	// Value is the ItemId of the new draft issue, a column that could not be set fires OnMutationCompleted(false)
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UGitHubCreateProjectItemAction *CreateProjectItemAsync(UObject *WorldContextObject, const FString &ProjectId, const FString &Title, const FString &FieldId, const FString &ColumnId);
+
+	virtual void Activate() override;
+
+private:
+	FString ProjectId;
+	FString Title;
+	FString FieldId;
+	FString ColumnId;
+};
+
+UCLASS()
+class UEGITHUBMANAGER_API UGitHubMoveProjectItemAction : public UGitHubAsyncTextAction
+{
+	GENERATED_BODY()
+
+public:
+	// Fires once GitHub applied or rejected the move, Cancel withdraws a move that has not been sent yet
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UGitHubMoveProjectItemAction *MoveProjectItemAsync(UObject *WorldContextObject, const FString &ProjectId, const FString &ItemId, const FString &NewColumnId, const FString &StatusFieldId);
+
+	virtual void Activate() override;
+
+private:
+	FString ProjectId;
+	FString ItemId;
+	FString NewColumnId;
+	FString StatusFieldId;
+};
+
+UCLASS()
+class UEGITHUBMANAGER_API UGitHubUpdateItemDateAction : public UGitHubAsyncTextAction
+{
+	GENERATED_BODY()
+
+public:
+	// Fires once GitHub applied or rejected the date, Cancel withdraws a date that has not been sent yet
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UGitHubUpdateItemDateAction *UpdateProjectItemDateValueAsync(UObject *WorldContextObject, const FString &ProjectId, const FString &ItemId, const FString &FieldId, const FString &NewDateValue);
+
+	virtual void Activate() override;
+
+private:
+	FString ProjectId;
+	FString ItemId;
+	FString FieldId;
+	FString NewDateValue;
+};
+
+UCLASS()
+class UEGITHUBMANAGER_API UGitHubFetchProjectBoardAction : public UGitHubAsyncAction
+{
+	GENERATED_BODY()
+
+public:
+	// Loads a board by ProjectId, the loaded board cache is updated as well
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Async", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UGitHubFetchProjectBoardAction *FetchProjectDetailsAsync(UObject *WorldContextObject, const FString &ProjectId);
+
+	virtual void Activate() override;
+
+	UPROPERTY(BlueprintAssignable)
+	FGitHubAsyncBoardResult OnSuccess;
+
+	UPROPERTY(BlueprintAssignable)
+	FGitHubAsyncBoardResult OnFailure;
+
+private:
+	FString ProjectId;
+};
@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "UGitHubAPIManager.h"
+#include "GitHubSnapshotLibrary.generated.h"
+
+/**
+ * Blueprint accessors for the shared snapshots published by UGitHubAPIManager.
+ * Only the requested entries are copied out, the snapshot itself is never duplicated.
+ */
+UCLASS()
+class UEGITHUBMANAGER_API UGitHubSnapshotLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Board
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static bool IsValidBoard(const FGitHubBoardHandle &Board);
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static FString GetBoardProjectId(const FGitHubBoardHandle &Board);
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static FString GetBoardTitle(const FGitHubBoardHandle &Board);
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static TArray<FColumnInfo> GetBoardColumns(const FGitHubBoardHandle &Board);
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static int32 GetBoardItemCount(const FGitHubBoardHandle &Board);
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static bool GetBoardItem(const FGitHubBoardHandle &Board, int32 Index, FProjectItem &OutItem);
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static bool FindBoardItem(const FGitHubBoardHandle &Board, const FString &ItemId, FProjectItem &OutItem);
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static TArray<FProjectItem> GetBoardItemsInColumn(const FGitHubBoardHandle &Board, const FString &ColumnId);
+
+	// Project list
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static bool IsValidProjectList(const FGitHubProjectListHandle &Projects);
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static int32 GetProjectCount(const FGitHubProjectListHandle &Projects);
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static bool GetProject(const FGitHubProjectListHandle &Projects, int32 Index, FProjectInfo &OutProject);
+
+	// Repository list
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static bool IsValidRepositoryList(const FGitHubRepositoryListHandle &Repositories);
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static int32 GetRepositoryCount(const FGitHubRepositoryListHandle &Repositories);
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static bool GetRepository(const FGitHubRepositoryListHandle &Repositories, int32 Index, FRepositoryInfo &OutRepository);
+
+	UFUNCTION(BlueprintPure, Category = "GitHub API|Snapshots")
+	static bool FindRepository(const FGitHubRepositoryListHandle &Repositories, const FString &RepositoryName, FRepositoryInfo &OutRepository);
+};
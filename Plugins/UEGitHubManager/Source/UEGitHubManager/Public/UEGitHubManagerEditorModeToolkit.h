@@ -9,6 +9,7 @@
 /**
  * This FModeToolkit just creates a basic UI panel that allows various InteractiveTools to
  * be initialized, and a DetailsView used to show properties of the active Tool.
+ * Below the tools it hosts the Kanban board and timeline of the selected GitHub project.
  */
 class FUEGitHubManagerEditorModeToolkit : public FModeToolkit
 {
@@ -18,8 +19,12 @@ public:
 	/** FModeToolkit interface */
 	virtual void Init(const TSharedPtr<IToolkitHost>& InitToolkitHost, TWeakObjectPtr<UEdMode> InOwningMode) override;
 	virtual void GetToolPaletteNames(TArray<FName>& PaletteNames) const override;
+	virtual TSharedPtr<SWidget> GetInlineContent() const override;
 
 	/** IToolkit interface */
 	virtual FName GetToolkitFName() const override;
 	virtual FText GetBaseToolkitName() const override;
+
+private:
+	TSharedPtr<SWidget> InlineContent;
 };
@@ -4,8 +4,34 @@
 
 #include "CoreMinimal.h"
 #include "Http.h"
+#include "HAL/CriticalSection.h"
+#include "Containers/Ticker.h"
+#include "GitHubAsync.h"
 #include "UGitHubAPIManager.generated.h"
 
+class FGitHubTraceFlow;
+class FGitHubConnectionPool;
+struct FGitHubProjectDiscovery;
+class FGitHubSearchIndex;
+class FGitHubTimelineIndex;
+class FGitHubMutationQueue;
+class FGitHubRequestTracker;
+class FGitHubStateStore;
+class FGitHubPageSizer;
+class FGitHubEntityCache;
+class FGitHubUsageHistory;
+class FGitHubItemDelivery;
+class FGitHubBoardCache;
+class FGitHubDashboard;
+class FGitHubBoardAnalytics;
+class FGitHubEventLog;
+struct FGitHubBoardDiff;
+struct FGitHubDashboardRun;
+struct FGitHubContentEntity;
+struct FGitHubRequestHandle;
+struct FGitHubQueuedMutation;
+enum class EGitHubMutationResult : uint8;
+
 /**
  *
  */
@@ -75,6 +101,24 @@ struct FProjectItem
 	FString StartDateFieldId;
 	UPROPERTY(BlueprintReadWrite)
 	FString EndDateFieldId;
+
+	// GraphQL id of the issue, pull request or draft issue, the same on every project it is on
+	UPROPERTY(BlueprintReadOnly)
+	FString ContentId;
+	UPROPERTY(BlueprintReadOnly)
+	FString UpdatedAt;
+
+	// StartDate/EndDate parsed once when the board is loaded, left at the default value when unset
+	UPROPERTY(BlueprintReadOnly)
+	FDateTime StartDateTime;
+	UPROPERTY(BlueprintReadOnly)
+	FDateTime EndDateTime;
+
+	// Hash of the card content except its column, compared by the board diff
+	uint64 ContentHash = 0;
+
+	// Set when the content could not be looked up, publishing keeps what the item showed before
+	bool bContentMissing = false;
 };
 
 USTRUCT(BlueprintType)
@@ -94,9 +138,19 @@ struct FProjectInfo
 	UPROPERTY(BlueprintReadWrite)
 	FString ProjectURL;
 
+	// Login of the user or organization that owns the project
+	UPROPERTY(BlueprintReadOnly)
+	FString OwnerLogin;
+
 	UPROPERTY(BlueprintReadOnly)
 	FString ColumnFieldId;
 
+	UPROPERTY(BlueprintReadOnly)
+	FString StartDateFieldId;
+
+	UPROPERTY(BlueprintReadOnly)
+	FString EndDateFieldId;
+
 	UPROPERTY(BlueprintReadWrite)
 	TArray<FColumnInfo> Columns;
 
@@ -104,16 +158,350 @@ struct FProjectInfo
 	TArray<FProjectItem> Items;
 };
 
+/**
+ * Immutable, reference-counted snapshot of one loaded project board.
+ * Every listener shares the same snapshot, read it through UGitHubSnapshotLibrary.
+ */
+USTRUCT(BlueprintType)
+struct FGitHubBoardHandle
+{
+	GENERATED_BODY()
+
+	TSharedPtr<const FProjectInfo, ESPMode::ThreadSafe> Snapshot;
+
+	bool IsValid() const { return Snapshot.IsValid(); }
+	const FProjectInfo *Get() const { return Snapshot.Get(); }
+};
+
+// Immutable snapshot of the discovered projects, items are not part of it
+USTRUCT(BlueprintType)
+struct FGitHubProjectListHandle
+{
+	GENERATED_BODY()
+
+	TSharedPtr<const TArray<FProjectInfo>, ESPMode::ThreadSafe> Snapshot;
+
+	bool IsValid() const { return Snapshot.IsValid(); }
+	const TArray<FProjectInfo> *Get() const { return Snapshot.Get(); }
+};
+
+// Immutable snapshot of the viewer's repositories
+USTRUCT(BlueprintType)
+struct FGitHubRepositoryListHandle
+{
+	GENERATED_BODY()
+
+	TSharedPtr<const TArray<FRepositoryInfo>, ESPMode::ThreadSafe> Snapshot;
+
+	bool IsValid() const { return Snapshot.IsValid(); }
+	const TArray<FRepositoryInfo> *Get() const { return Snapshot.Get(); }
+};
+
+USTRUCT(BlueprintType)
+struct FGitHubTransferStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 ResponseCount = 0;
+
+	// Bytes received over the network, compressed if the server compressed the response
+	UPROPERTY(BlueprintReadOnly)
+	int64 CompressedBytes = 0;
+
+	// Bytes handed to the JSON decoder after inflation
+	UPROPERTY(BlueprintReadOnly)
+	int64 UncompressedBytes = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FGitHubConnectionSettings
+{
+	GENERATED_BODY()
+
+	// Upper bound of parallel connections to api.github.com, further requests wait for a free one
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "1"))
+	int32 MaxConnections = 4;
+
+	// How long an idle connection is assumed to stay open for reuse
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"))
+	float KeepAliveSeconds = 60.0f;
+
+	// Open a connection as soon as an access token is set
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bWarmUpOnTokenSet = true;
+
+	// Paged queries shrink their page size when a page takes longer than this and only grow well below it
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0.1"))
+	float TargetPageSeconds = 2.0f;
+
+	// Rate limit points one page may cost (rateLimit.cost), 0 for no limit
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"))
+	int32 MaxPageCost = 10;
+};
+
+USTRUCT(BlueprintType)
+struct FGitHubConnectionStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 RequestsDispatched = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 NewConnections = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 ReusedConnections = 0;
+
+	// ReusedConnections / RequestsDispatched
+	UPROPERTY(BlueprintReadOnly)
+	float ReuseRate = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 ActiveConnections = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 IdleConnections = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 QueuedRequests = 0;
+
+	// Requests dropped because a newer request replaced them
+	UPROPERTY(BlueprintReadOnly)
+	int32 CancelledRequests = 0;
+
+	// Bytes received by background requests such as prefetches
+	UPROPERTY(BlueprintReadOnly)
+	int64 BackgroundBytes = 0;
+
+	// GraphQL rate limit points left in the current window and its size, -1 until GitHub reported them
+	UPROPERTY(BlueprintReadOnly)
+	int32 RateLimitRemaining = -1;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 RateLimitLimit = -1;
+};
+
+enum class EGitHubRequestPriority : uint8
+{
+	Normal,
+	// Only sent while no normal request waits for a connection
+	Background
+};
+
+USTRUCT(BlueprintType)
+struct FGitHubPrefetchSettings
+{
+	GENERATED_BODY()
+
+	// Load the boards of the most used projects in the background once the project list arrives
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bEnabled = true;
+
+	// Boards kept ready at a time
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"))
+	int32 MaxProjects = 3;
+
+	// Download budget of all prefetches in one session
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"))
+	float MaxMegabytes = 16.0f;
+
+	// Share of the GraphQL rate limit window prefetching never touches
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0", ClampMax = "1"))
+	float RateLimitReserve = 0.5f;
+
+	// An open counts half as much after this many days
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (ClampMin = "0"))
+	float HistoryHalfLifeDays = 7.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FGitHubBoardCacheStats
+{
+	GENERATED_BODY()
+
+	// Boards held in memory with their search and timeline index
+	UPROPERTY(BlueprintReadOnly)
+	int32 ResidentBoards = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	int64 ResidentBytes = 0;
+
+	// Boards evicted to disk, read back when their project is used again
+	UPROPERTY(BlueprintReadOnly)
+	int32 SpilledBoards = 0;
+};
+
+// Item counts of one project, columns by name and items by OPEN, CLOSED, MERGED or DRAFT
+USTRUCT(BlueprintType)
+struct FGitHubProjectCounts
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	FString ProjectId;
+
+	UPROPERTY(BlueprintReadOnly)
+	FString ProjectTitle;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 ItemCount = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	TMap<FString, int32> ColumnCounts;
+
+	UPROPERTY(BlueprintReadOnly)
+	TMap<FString, int32> StateCounts;
+
+	// False while pages of the project are still being counted
+	UPROPERTY(BlueprintReadOnly)
+	bool bComplete = false;
+};
+
+USTRUCT(BlueprintType)
+struct FGitHubDashboardSummary
+{
+	GENERATED_BODY()
+
+	// Totals over all projects of the dashboard
+	UPROPERTY(BlueprintReadOnly)
+	int32 ItemCount = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	TMap<FString, int32> ColumnCounts;
+
+	UPROPERTY(BlueprintReadOnly)
+	TMap<FString, int32> StateCounts;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 CompleteProjects = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	TArray<FGitHubProjectCounts> Projects;
+};
+
+// Time items spent in one column, measured between the moves seen this session
+USTRUCT(BlueprintType)
+struct FGitHubColumnTimeStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	FString ColumnId;
+
+	UPROPERTY(BlueprintReadOnly)
+	FString ColumnName;
+
+	// Items in the column right now
+	UPROPERTY(BlueprintReadOnly)
+	int32 ItemCount = 0;
+
+	// Stays that ended with the item moving on
+	UPROPERTY(BlueprintReadOnly)
+	int32 CompletedStays = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	float AverageHours = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly)
+	float MaxHours = 0.0f;
+
+	// Completed stays per bucket of FGitHubBoardMetrics::HistogramBoundsHours
+	UPROPERTY(BlueprintReadOnly)
+	TArray<int32> Histogram;
+};
+
+USTRUCT(BlueprintType)
+struct FGitHubThroughputWeek
+{
+	GENERATED_BODY()
+
+	// Monday of the week, UTC
+	UPROPERTY(BlueprintReadOnly)
+	FDateTime WeekStart;
+
+	UPROPERTY(BlueprintReadOnly)
+	int32 CompletedItems = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FGitHubBurndownPoint
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	FDateTime Day;
+
+	// Items whose EndDate is after Day
+	UPROPERTY(BlueprintReadOnly)
+	int32 PlannedRemaining = 0;
+
+	// Items with an EndDate that were not done by the end of Day
+	UPROPERTY(BlueprintReadOnly)
+	int32 ActualRemaining = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FGitHubBoardMetrics
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	FString ProjectId;
+
+	// Upper bounds of the histogram buckets, the last bucket has none
+	UPROPERTY(BlueprintReadOnly)
+	TArray<float> HistogramBoundsHours;
+
+	// In board order
+	UPROPERTY(BlueprintReadOnly)
+	TArray<FGitHubColumnTimeStats> Columns;
+
+	// Items seen reaching the last column, timed from their creation
+	UPROPERTY(BlueprintReadOnly)
+	int32 CycleTimeItems = 0;
+
+	UPROPERTY(BlueprintReadOnly)
+	float AverageCycleTimeHours = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly)
+	TArray<int32> CycleTimeHistogram;
+
+	// Oldest week first, weeks without completions are left out
+	UPROPERTY(BlueprintReadOnly)
+	TArray<FGitHubThroughputWeek> Throughput;
+
+	// Items with an EndDate
+	UPROPERTY(BlueprintReadOnly)
+	int32 BurndownScope = 0;
+
+	// A point for every day on which an item is due or was done, oldest first
+	UPROPERTY(BlueprintReadOnly)
+	TArray<FGitHubBurndownPoint> Burndown;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnUserNameReceived, const FString &, UserName);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRepositoriesLoaded, const TArray<FRepositoryInfo> &, Repositories);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRepositoryDetailsLoaded, const FRepositoryInfo &, RepositoryInfo);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnProjectCreated, const FString &, ProjectUrl);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnUserProjectsLoaded, const TArray<FProjectInfo> &, Projects);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnProjectDiscoveryCompleted, int32, ProjectCount);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnProjectDetailsLoaded, const FProjectInfo &, ProjectInfo);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMutationCompleted, bool, bSuccess);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnItemCreated);
-
-UCLASS(Blueprintable)
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPendingMutationsChanged, int32, PendingCount);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDashboardUpdated, const FGitHubDashboardSummary &, Summary);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRepositoryListPublished, const FGitHubRepositoryListHandle &, Repositories);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnProjectListPublished, const FGitHubProjectListHandle &, Projects);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnProjectBoardPublished, const FGitHubBoardHandle &, Board);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBoardDeliveryCompleted, const FString &, ProjectId, int32, ItemCount);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnItemsAdded, const FString &, ProjectId, const TArray<FProjectItem> &, Items);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnItemsChanged, const FString &, ProjectId, const TArray<FProjectItem> &, Items);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnItemsRemoved, const FString &, ProjectId, const TArray<FString> &, ItemIds);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnItemMoved, const FString &, ProjectId, const FProjectItem &, Item, const FString &, FromColumnId, const FString &, ToColumnId);
+
+UCLASS(Blueprintable, Config = Game)
 class UEGITHUBMANAGER_API UGitHubAPIManager : public UObject
 {
 	GENERATED_BODY()
@@ -121,6 +509,9 @@ class UEGITHUBMANAGER_API UGitHubAPIManager : public UObject
 public:
 	UGitHubAPIManager();
 
+	virtual void PostInitProperties() override;
+	virtual void BeginDestroy() override;
+
 	UFUNCTION(BlueprintCallable, Category = "GitHub API")
 	void SetAccessToken(const FString &AuthToken);
 
@@ -139,9 +530,32 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GitHub API")
 	void FetchUserRepositories();
 
+	// Copy of the current repository snapshot, prefer GetRepositoryListHandle for large lists
 	UFUNCTION(BlueprintCallable, Category = "GitHub API")
 	TArray<FRepositoryInfo> GetRepositoryList();
 
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Snapshots")
+	FGitHubRepositoryListHandle GetRepositoryListHandle() const;
+
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Snapshots")
+	FGitHubProjectListHandle GetProjectListHandle() const;
+
+	// Latest snapshot of a loaded board, invalid if the project has not been loaded.
+	// A board evicted to disk is read back and refreshed.
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Snapshots")
+	FGitHubBoardHandle GetBoardHandle(const FString &ProjectId);
+
+	// Snapshot counterparts of OnRepositoriesLoaded, OnUserProjectsLoaded and OnProjectDetailsLoaded.
+	// The by-value delegates are only built and broadcast while something is bound to them.
+	UPROPERTY(BlueprintAssignable, Category = "GitHub API|Snapshots")
+	FOnRepositoryListPublished OnRepositoryListPublished;
+
+	UPROPERTY(BlueprintAssignable, Category = "GitHub API|Snapshots")
+	FOnProjectListPublished OnProjectListPublished;
+
+	UPROPERTY(BlueprintAssignable, Category = "GitHub API|Snapshots")
+	FOnProjectBoardPublished OnProjectBoardPublished;
+
 	UFUNCTION(BlueprintCallable, Category = "GitHub API")
 	void FetchRepositoryDetails(const FString &RepositoryName);
 
@@ -163,18 +577,122 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GitHub API")
 	void FetchProjectDetails(const FString &ProjectName);
 
+	// Reloads a project and reports what changed through OnItemsAdded/Changed/Removed and OnItemMoved, followed by
+	// the whole board on OnProjectBoardPublished and OnProjectDetailsLoaded.
+	// Falls back to a full load when the project has not been loaded yet; an unchanged board broadcasts nothing.
+	UFUNCTION(BlueprintCallable, Category = "GitHub API")
+	void RefreshProjectDetails(const FString &ProjectName);
+
+	// Reloads only these items of a loaded project and reports them through the item events below.
+	// Calls made within one frame are collected and sent together as nodes(ids: [...]) lookups.
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Items")
+	void RevalidateItems(const FString &ProjectId, const TArray<FString> &ItemIds);
+
+	UPROPERTY(BlueprintAssignable, Category = "GitHub API|Items")
+	FOnItemsAdded OnItemsAdded;
+
+	UPROPERTY(BlueprintAssignable, Category = "GitHub API|Items")
+	FOnItemsChanged OnItemsChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "GitHub API|Items")
+	FOnItemsRemoved OnItemsRemoved;
+
+	UPROPERTY(BlueprintAssignable, Category = "GitHub API|Items")
+	FOnItemMoved OnItemMoved;
+
+	// Fires once per owner (viewer or organization) as its projects arrive, with everything discovered so far
 	UPROPERTY(BlueprintAssignable, Category = "GitHub API")
 	FOnUserProjectsLoaded OnUserProjectsLoaded;
 
+	UPROPERTY(BlueprintAssignable, Category = "GitHub API")
+	FOnProjectDiscoveryCompleted OnProjectDiscoveryCompleted;
+
+	// Number of owners whose projects are paged in parallel during FetchUserProjects
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "GitHub API|Projects", meta = (ClampMin = "1"))
+	int32 MaxConcurrentProjectSources = 3;
+
 	UPROPERTY(BlueprintAssignable, Category = "GitHub API")
 	FOnProjectDetailsLoaded OnProjectDetailsLoaded;
 
+	// Milliseconds per frame spent handing the items of a freshly loaded board to listeners, 0 hands them over at once.
+	// While sliced, OnProjectDetailsLoaded only carries the columns and the items follow in chunks through OnItemsAdded,
+	// so it is off by default and only meant for listeners that handle OnItemsAdded.
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "GitHub API|Delivery", meta = (ClampMin = "0"))
+	float DeliveryBudgetMs = 0.0f;
+
+	// Items in these columns are delivered first, an empty list clears the preference
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Delivery")
+	void SetVisibleColumns(const FString &ProjectId, const TArray<FString> &ColumnIds);
+
+	// Items overlapping [From, To] are delivered first, From >= To clears the preference
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Delivery")
+	void SetVisibleDateRange(const FString &ProjectId, const FDateTime &From, const FDateTime &To);
+
+	// Fires once every item of a loaded board reached the listeners, right after OnProjectDetailsLoaded when not sliced
+	UPROPERTY(BlueprintAssignable, Category = "GitHub API|Delivery")
+	FOnBoardDeliveryCompleted OnBoardDeliveryCompleted;
+
+	// Counts the items of these projects per column and state, all discovered projects if the list is empty.
+	// Loaded boards are counted locally, the others page through just the status and state of their items.
+	// The counts then follow every change of a loaded board, OnDashboardUpdated fires at most once per frame.
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Dashboard")
+	void FetchDashboard(const TArray<FString> &ProjectIds);
+
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Dashboard")
+	FGitHubDashboardSummary GetDashboardSummary() const;
+
+	UPROPERTY(BlueprintAssignable, Category = "GitHub API|Dashboard")
+	FOnDashboardUpdated OnDashboardUpdated;
+
+	// Projects counted in parallel by FetchDashboard, the connection pool still limits the requests
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "GitHub API|Dashboard", meta = (ClampMin = "1"))
+	int32 MaxConcurrentDashboardProjects = 4;
+
+	// Time per column, cycle time, weekly throughput and burndown of a board, kept current from its item changes
+	// since it was first loaded this session. The last column of the board counts as done.
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Analytics")
+	FGitHubBoardMetrics GetBoardMetrics(const FString &ProjectId) const;
+
+	// The board as it was at Time, rebuilt from its event log in Saved/GitHubManager/EventLog. Items carry their column,
+	// title and dates, columns and field ids are those of the board as loaded now. False if nothing was recorded before Time.
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|History")
+	bool GetBoardAtTime(const FString &ProjectId, const FDateTime &Time, FProjectInfo &OutBoard);
+
+	// Full-text search over title, body, state, type and column of a loaded project. Returns item IDs, best match first.
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Search")
+	TArray<FString> SearchProjectItems(const FString &ProjectId, const FString &Query, int32 MaxResults = 50);
+
+	// Items of a loaded project whose StartDate..EndDate intersects [From, To], ordered by start
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Timeline")
+	TArray<FString> QueryTimelineOverlap(const FString &ProjectId, const FDateTime &From, const FDateTime &To);
+
+	// Items of a loaded project whose StartDate..EndDate lies completely inside [From, To], ordered by start
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Timeline")
+	TArray<FString> QueryTimelineRange(const FString &ProjectId, const FDateTime &From, const FDateTime &To);
+
+	// The next items of a loaded project ending at or after After, soonest EndDate first
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Timeline")
+	TArray<FString> GetNextDueItems(const FString &ProjectId, const FDateTime &After, int32 MaxResults = 10);
+
+	// Edits of the same item and field within DateEditDebounceSeconds collapse into the last value;
+	// start and end date changes of one item are sent together.
 	UFUNCTION(BlueprintCallable, Category = "GitHub API")
 	void UpdateProjectItemDateValue(const FString &ProjectId, const FString &ItemId, const FString &FieldId, const FString &NewDateValue);
 
 	UPROPERTY(BlueprintAssignable, Category = "GitHub API")
 	FOnMutationCompleted OnMutationCompleted;
 
+	// Date and column edits are journaled on disk and replayed in order once GitHub is reachable again
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Offline")
+	int32 GetPendingMutationCount() const;
+
+	UPROPERTY(BlueprintAssignable, Category = "GitHub API|Offline")
+	FOnPendingMutationsChanged OnPendingMutationsChanged;
+
+	// Quiet time after the last date edit of an item field before it is sent, 0 sends every edit
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "GitHub API|Timeline", meta = (ClampMin = "0"))
+	float DateEditDebounceSeconds = 0.3f;
+
 	UFUNCTION(BlueprintCallable, Category = "GitHub API")
 	void CreateProjectItem(const FString &ProjectId, const FString &Title, const FString &FieldId, const FString &ColumnId);
 
@@ -184,26 +702,244 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "GitHub API")
 	void MoveProjectItem(const FString &ProjectId, const FString &ItemId, const FString &NewColumnId, const FString &StatusFieldId);
 
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Diagnostics")
+	FGitHubTransferStats GetTransferStats() const;
+
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Diagnostics")
+	void ResetTransferStats();
+
+	// Current adaptive page size of "Repositories", "Projects" or "ProjectItems"
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Diagnostics")
+	int32 GetPageSize(const FString &QueryShape) const;
+
+	// Issues, pull requests and draft issues held once for all loaded boards
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Diagnostics")
+	int32 GetCachedEntityCount() const;
+
+	// Memory the loaded boards and their indices may take before the least recently used ones are written to disk,
+	// 0 for no limit. An evicted board is read back as soon as its project is opened, searched or edited again.
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "GitHub API|Cache", meta = (ClampMin = "0"))
+	int32 BoardCacheBudgetMegabytes = 256;
+
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Diagnostics")
+	FGitHubBoardCacheStats GetBoardCacheStats() const;
+
+	// Loaded from [/Script/UEGitHubManager.GitHubAPIManager] in DefaultGame.ini
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "GitHub API|Connection")
+	FGitHubConnectionSettings ConnectionSettings;
+
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Connection")
+	void SetConnectionSettings(const FGitHubConnectionSettings &NewSettings);
+
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Connection")
+	void WarmUpConnection();
+
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Connection")
+	FGitHubConnectionStats GetConnectionStats() const;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "GitHub API|Prefetch")
+	FGitHubPrefetchSettings PrefetchSettings;
+
+	// True while a background-loaded board of the project is waiting to be opened
+	UFUNCTION(BlueprintCallable, Category = "GitHub API|Prefetch")
+	bool IsProjectPrefetched(const FString &ProjectId) const;
+
+	// Composable C++ counterparts of the calls above, the Blueprint nodes live in GitHubAsyncActions.h.
+	// Futures complete on the worker that decoded the response, so continuations can start the next request
+	// without a game thread hop; marshal back with AsyncTask before touching UObjects.
+	// The delegates above still fire, a Token cancels just this one operation.
+	TGitHubFuture<FString> FetchCurrentUserAsync(const FGitHubCancellationTokenPtr &Token = nullptr);
+	TGitHubFuture<FGitHubBoardHandle> FetchProjectDetailsAsync(const FString &ProjectId, const FGitHubCancellationTokenPtr &Token = nullptr);
+
+	// Resolves to the ProjectId once the project exists, StartDate and EndDate fields that could not be added
+	// are reported through OnMutationCompleted(false) instead of failing the project
+	TGitHubFuture<FString> CreateNewProjectAsync(const FString &Owner, const FString &ProjectName, const FGitHubCancellationTokenPtr &Token = nullptr);
+
+	// Resolves to the ItemId of the new draft issue, a column that could not be set is reported through
+	// OnMutationCompleted(false) instead of failing the item
+	TGitHubFuture<FString> CreateProjectItemAsync(const FString &ProjectId, const FString &Title, const FString &FieldId, const FString &ColumnId, const FGitHubCancellationTokenPtr &Token = nullptr);
+
+	// Resolve to the ItemId on the game thread once GitHub applied or rejected the journaled edit.
+	// Cancelling withdraws an edit that has not been sent yet and reloads the board to undo it.
+	TGitHubFuture<FString> UpdateProjectItemDateValueAsync(const FString &ProjectId, const FString &ItemId, const FString &FieldId, const FString &NewDateValue, const FGitHubCancellationTokenPtr &Token = nullptr);
+	TGitHubFuture<FString> MoveProjectItemAsync(const FString &ProjectId, const FString &ItemId, const FString &NewColumnId, const FString &StatusFieldId, const FGitHubCancellationTokenPtr &Token = nullptr);
+
 private:
 	FHttpModule *Http;
 	FString AccessToken;
 	static UGitHubAPIManager *SingletonInstance;
-	TMap<FString, FRepositoryInfo> RepositoryInfos;
-	TMap<FString, FProjectInfo> UserProjects;
-	FRepositoryInfo ActiveRepository;
+
+	// Repositories, discovered projects and the active repository, readable and writable from any thread
+	TSharedPtr<FGitHubStateStore, ESPMode::ThreadSafe> StateStore;
+
+	// Updated from worker threads while responses are decoded
+	mutable FCriticalSection TransferStatsLock;
+	FGitHubTransferStats TransferStats;
+
+	TSharedPtr<FGitHubConnectionPool, ESPMode::ThreadSafe> ConnectionPool;
+	TSharedPtr<FGitHubRequestTracker, ESPMode::ThreadSafe> RequestTracker;
+	TSharedPtr<FGitHubPageSizer, ESPMode::ThreadSafe> PageSizer;
+	TSharedPtr<FGitHubEntityCache, ESPMode::ThreadSafe> EntityCache;
+	TSharedPtr<FGitHubProjectDiscovery> ActiveDiscovery;
+
+	// Pending item field edits, sent one at a time and retried with backoff while GitHub is unreachable
+	TSharedPtr<FGitHubMutationQueue> MutationQueue;
+	FTSTicker::FDelegateHandle MutationRetryHandle;
+	FTSTicker::FDelegateHandle StagedMutationHandle;
+	float MutationRetryDelay = 0.0f;
+
+	// Futures waiting on a queued edit, by "ItemId/FieldId"
+	TMap<FString, TArray<TSharedRef<TGitHubPromise<FString>, ESPMode::ThreadSafe>>> MutationPromises;
+
+	// Last published board and its search and timeline index per ProjectId, game thread only.
+	// Boards are copied on write while a published handle still shares them.
+	TMap<FString, TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>> LoadedBoards;
+	TMap<FString, TSharedPtr<FGitHubSearchIndex>> SearchIndices;
+	TMap<FString, TSharedPtr<FGitHubTimelineIndex>> TimelineIndices;
+
+	// Footprint and last use of the loaded boards, and the boards evicted to disk
+	TSharedPtr<FGitHubBoardCache> BoardCache;
+
+	// Boards loaded ahead of time from the usage history, handed out when their project is opened
+	TSharedPtr<FGitHubUsageHistory> UsageHistory;
+	TMap<FString, TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>> PrefetchedBoards;
+	TArray<FString> PrefetchQueue;
+	FString PrefetchingProjectId;
+	FGitHubCancellationTokenPtr PrefetchToken;
+
+	// Items of freshly published boards still to be handed to listeners
+	TSharedPtr<FGitHubItemDelivery> ItemDelivery;
+	FTSTicker::FDelegateHandle DeliveryHandle;
+
+	// Item ids per ProjectId waiting for the revalidation lookup on the next tick
+	TMap<FString, TSet<FString>> PendingRevalidation;
+	FTSTicker::FDelegateHandle RevalidationHandle;
+
+	// Counts per project of the last FetchDashboard and the run still counting
+	TSharedPtr<FGitHubDashboard> Dashboard;
+	TSharedPtr<FGitHubDashboardRun> ActiveDashboardRun;
+	FTSTicker::FDelegateHandle DashboardBroadcastHandle;
+
+	// Flow metrics per ProjectId, kept when the board itself is moved to disk
+	TMap<FString, TSharedPtr<FGitHubBoardAnalytics>> BoardAnalytics;
+
+	// Every item change seen on a board, appended to one file per project
+	TSharedPtr<FGitHubEventLog> EventLog;
+	FTSTicker::FDelegateHandle EventLogFlushHandle;
+	FDelegateHandle PreExitHandle;
 
 	void LogHttpError(FHttpResponsePtr Response) const;
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateHttpRequest(const FString &URL, const FString &Verb);
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateGraphQLRequest(const FString &Document);
+
+	// Every request goes through the connection pool instead of calling ProcessRequest directly
+	void DispatchRequest(TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request, EGitHubRequestPriority Priority = EGitHubRequestPriority::Normal);
+
+	// Makes Request the current one of Slot and cancels the request it replaces
+	FGitHubRequestHandle BeginSupersedingRequest(const FString &Slot, TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request);
+
+	// Starts a load of several requests in Slot and cancels the request of the load it replaces
+	FGitHubRequestHandle BeginSupersedingLoad(const FString &Slot);
+
+	// Response decoding, safe to call from worker threads
+	bool DecodeResponseBody(FHttpResponsePtr Response, FString &OutBody);
+	// bOutOversized is set when GitHub refused the query for asking too much at once
+	TSharedPtr<FJsonObject> DeserializeGraphQLResponse(FHttpResponsePtr Response, bool *bOutOversized = nullptr);
+
+	// Queues Task on a background worker inside the given trace flow
+	void RunOnWorkerThread(const TSharedPtr<FGitHubTraceFlow, ESPMode::ThreadSafe> &Flow, TUniqueFunction<void()> Task);
+
+	// Queues Task on the game thread, carrying the trace flow of the response currently being handled
+	void RunOnGameThread(TUniqueFunction<void()> Task);
 
 	// ResponseHandler
-	void HandleRepoListResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
-	void HandleRepoDetailsResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
-	void HandleFetchUserProjectsResponse(TSharedPtr<FJsonObject> ResponseObject);
-	void HandleFetchProjectDetailsResponse(TSharedPtr<FJsonObject> ResponseObject, const FString &ProjectName);
+	void FetchRepositoryPage(TSharedRef<TMap<FString, FRepositoryInfo>, ESPMode::ThreadSafe> LoadedRepositories, const FString &Cursor);
+	bool HandleRepoListResponse(TSharedPtr<FJsonObject> ResponseObject, TMap<FString, FRepositoryInfo> &OutRepositories, FString &OutNextCursor);
+	void HandleRepoDetailsResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, const FGitHubRequestHandle &Handle);
+	bool HandleFetchUserProjectsResponse(TSharedPtr<FJsonObject> ResponseObject, const FString &OwnerField, TArray<FProjectInfo> &OutProjects, FString &OutNextCursor);
+	TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> ParseProjectDetails(TSharedPtr<FJsonObject> ResponseObject, FString &OutNextCursor);
+	bool ParseProjectItem(TSharedPtr<FJsonObject> ItemObject, const FString &StartDateFieldId, const FString &EndDateFieldId, FProjectItem &OutItem);
+
+	// Board cache, game thread only
+	void RequestProjectDetails(const FString &ProjectId, bool bIncremental);
+	// Publishes a prefetched or evicted board and refreshes it, returns the published board or nullptr if none was cached
+	TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> ShowCachedBoard(const FString &ProjectId);
+	void ResolveBoardContent(TSharedRef<FProjectInfo, ESPMode::ThreadSafe> Board, const FGitHubCancellationTokenPtr &Token, EGitHubRequestPriority Priority, TFunction<void(TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>)> OnResolved);
+	void FetchContentEntities(const TArray<FString> &Ids, int32 FirstIndex, const FGitHubCancellationTokenPtr &Token, EGitHubRequestPriority Priority, TSharedRef<TMap<FString, TSharedRef<const FGitHubContentEntity, ESPMode::ThreadSafe>>, ESPMode::ThreadSafe> Entities, TSharedRef<TSet<FString>, ESPMode::ThreadSafe> ChangedIds, TFunction<void(const TSet<FString> &)> OnFetched);
+	bool ParseContentEntity(TSharedPtr<FJsonObject> ContentObject, FGitHubContentEntity &OutEntity);
+	void PropagateEntityChanges(const TSet<FString> &ContentIds, const FString &SourceProjectId);
+	void KeepPreviousContent(const FProjectInfo &PreviousBoard, FProjectInfo &Board);
+	void PruneEntityCache();
+	void FetchBoardPage(const FString &ProjectId, TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> Board, const FString &Cursor, const FGitHubRequestHandle &LoadHandle, const FGitHubCancellationTokenPtr &Token, EGitHubRequestPriority Priority, TFunction<void(TSharedPtr<FProjectInfo, ESPMode::ThreadSafe>)> OnLoaded);
+	void PublishProjectDetails(const TSharedRef<FProjectInfo, ESPMode::ThreadSafe> &Board, bool bIncremental);
+	void UpdateLoadedItem(const FString &ProjectId, const FString &ItemId, TFunctionRef<void(FProjectItem &)> Mutation);
+	void FlushRevalidation();
+	void FetchRevalidatedItems(const FString &ProjectId, const TArray<FString> &ItemIds);
+	void MergeRevalidatedItems(const FString &ProjectId, const TArray<FProjectItem> &FreshItems, const TArray<FString> &GoneItemIds);
+	void StartItemDelivery(const FProjectInfo &Board);
+
+	// Board memory budget, game thread only. Lookups never go to disk, opening or editing a board restores an evicted one.
+	TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> *FindLoadedBoard(const FString &ProjectId);
+	TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> *FindOrRestoreBoard(const FString &ProjectId);
+	TSharedPtr<FProjectInfo, ESPMode::ThreadSafe> RestoreBoard(const FString &ProjectId);
+	void IndexBoard(const FProjectInfo &Board);
+	void TrackBoardFootprint(const FString &ProjectId);
+	void EnforceBoardBudget();
+
+	// Dashboard, game thread only except for ParseDashboardPage
+	void PumpDashboard(TSharedPtr<FGitHubDashboardRun> Run);
+	void FetchDashboardPage(TSharedPtr<FGitHubDashboardRun> Run, const FString &ProjectId, TSharedRef<FGitHubProjectCounts, ESPMode::ThreadSafe> Counts, const FString &Cursor);
+	bool ParseDashboardPage(TSharedPtr<FJsonObject> ResponseObject, FGitHubProjectCounts &InOutCounts, FString &OutNextCursor);
+	void UpdateDashboardFromBoard(const FProjectInfo &Board);
+	void ScheduleDashboardBroadcast();
+
+	// Board analytics, game thread only. Without a diff every item of the board is compared with its record.
+	void UpdateBoardAnalytics(const FProjectInfo &Board, const FGitHubBoardDiff *Diff);
+
+	// Board history, game thread only. Without a diff every item of the board is compared with its logged state.
+	void RecordBoardHistory(const FProjectInfo &Board, const FGitHubBoardDiff *Diff);
+	void ScheduleEventLogFlush();
+
+	// Writes every recorded event and staged edit before the editor exits or the manager goes away
+	void FlushBeforeExit();
+	void FlushEventLogNow();
+
+	// Background prefetch, game thread only
+	void RecordProjectOpen(const FString &ProjectId);
+	void SchedulePrefetch(const TArray<FProjectInfo> &Projects);
+	void PumpPrefetch();
+	bool HasPrefetchBudget() const;
+
+	// Offline mutation queue, game thread only
+	void QueueFieldValueUpdate(const FGitHubQueuedMutation &Mutation);
+	void PumpMutationQueue();
+	void FlushStagedMutations();
+	void HandleQueuedMutationResult(const TArray<FGitHubQueuedMutation> &Batch, EGitHubMutationResult Result);
+	TGitHubFuture<FString> TrackQueuedMutation(const FString &ProjectId, const FString &ItemId, const FString &FieldId, const FGitHubCancellationTokenPtr &Token);
+	void WithdrawQueuedMutation(const FString &ProjectId, const FString &ItemId, const FString &FieldId);
+	void CompleteQueuedMutation(const FString &ItemId, const FString &FieldId, const FString &Error);
+
+	// Project discovery
+	void PumpProjectDiscovery(TSharedPtr<FGitHubProjectDiscovery> Discovery);
+	void FetchProjectSourcePage(TSharedPtr<FGitHubProjectDiscovery> Discovery, const FString &Owner, const FString &Cursor);
+	void PublishDiscoveredProjects(TSharedPtr<FGitHubProjectDiscovery> Discovery, bool bComplete);
 
 	// GraphQL
-	void SendGraphQLQuery(const FString &Query, const TFunction<void(TSharedPtr<FJsonObject>)> &Callback);
-	void SendGraphQLMutation(const FString &Mutation, const TFunction<void(TSharedPtr<FJsonObject>)> &Callback);
+	// With a SupersedeSlot, a newer query in the same slot cancels this one and its response is never handled
+	void SendGraphQLQuery(const FString &Query, const TFunction<void(TSharedPtr<FJsonObject>)> &Callback, const TCHAR *TraceLabel = TEXT("GraphQLQuery"), const FString &SupersedeSlot = FString());
+	void SendGraphQLMutation(const FString &Mutation, const TFunction<void(TSharedPtr<FJsonObject>)> &Callback, const TCHAR *TraceLabel = TEXT("GraphQLMutation"));
+
+	// One page of a connection, sized by the page sizer for Shape. BuildQuery gets the page size; a page GitHub
+	// refuses as too large is asked for again with a smaller one. The callback gets null on failure or cancel.
+	// With a LoadHandle from BeginSupersedingLoad the page is part of that load, once superseded it is dropped unanswered.
+	void SendPagedQuery(const FString &Shape, const TArray<FString> &ConnectionPath, TFunction<FString(int32)> BuildQuery, TFunction<void(TSharedPtr<FJsonObject>)> Callback, const TCHAR *TraceLabel, const FGitHubRequestHandle &LoadHandle = FGitHubRequestHandle(), const FGitHubCancellationTokenPtr &Token = nullptr, EGitHubRequestPriority Priority = EGitHubRequestPriority::Normal);
+
+	// Queries and mutations alike, the future holds the decoded response or why there is none
+	TGitHubFuture<TSharedPtr<FJsonObject>> SendGraphQLAsync(const FString &Document, const TCHAR *TraceLabel, const FGitHubCancellationTokenPtr &Token, EGitHubRequestPriority Priority = EGitHubRequestPriority::Normal);
+
+	// Reads FieldName from the object at ObjectPath ("data", "user", ...) of the response
+	TGitHubFuture<FString> QueryStringFieldAsync(const FString &Document, const TArray<FString> &ObjectPath, const FString &FieldName, const TCHAR *TraceLabel, const FGitHubCancellationTokenPtr &Token);
+	TGitHubFuture<FString> CreateProjectFieldAsync(const FString &ProjectId, const FString &FieldName, const FGitHubCancellationTokenPtr &Token);
 
 	FString GetStringFieldSafe(TSharedPtr<FJsonObject> JsonObject, const FString &FieldName);
 	TOptional<int32> GetIntegerFieldSafe(TSharedPtr<FJsonObject> JsonObject, const FString &FieldName);
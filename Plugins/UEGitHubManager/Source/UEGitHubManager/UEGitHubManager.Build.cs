@@ -57,6 +57,9 @@ public class UEGitHubManager : ModuleRules
 			}
 			);
 
+		// Streaming inflation of gzip/deflate API responses
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
 
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]